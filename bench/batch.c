@@ -0,0 +1,75 @@
+#include <stdio.h>
+#include <time.h>
+#include "linkedlist/intlist.h"
+#include "arraylist/intvec.h"
+
+#define SIZE 10000000
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int triple(int value) {
+    return 3 * value;
+}
+
+static void triple_batch(int* values, size_t size, void* ctx) {
+    (void) ctx;
+    for (size_t i = 0; i < size; i++) values[i] *= 3;
+}
+
+static long long add(long long acc, int value) {
+    return acc + value;
+}
+
+static long long add_batch(long long acc, const int* values, size_t size, void* ctx) {
+    (void) ctx;
+    for (size_t i = 0; i < size; i++) acc += values[i];
+    return acc;
+}
+
+static void report(const char* name, double per_element, double batch, bool same) {
+    printf("%-20s%10.3fs%10.3fs  x%.2f%s\n", name, per_element, batch, per_element / batch, same ? "" : "  MISMATCH");
+}
+
+int main() {
+    IntList list = intlist_new();
+    IntVec vec = intvec_with_capacity(SIZE);
+    for (int i = 0; i < SIZE; i++) {
+        if (!intlist_push(list, i) || !intvec_push(vec, i)) return 1;
+    }
+
+    printf("%d elements\n", SIZE);
+    printf("%-20s%11s%11s\n", "", "per element", "batch");
+
+    double start = now();
+    IntList mapped = intlist_map(list, triple);
+    double per_element = now() - start;
+    start = now();
+    IntList batch_mapped = intlist_map_batch(list, triple_batch, NULL);
+    report("intlist map", per_element, now() - start, intlist_equals(mapped, batch_mapped));
+
+    start = now();
+    long long reduced = intlist_reduce(list, add, 0);
+    per_element = now() - start;
+    start = now();
+    long long batch_reduced = intlist_reduce_batch(list, add_batch, 0, NULL);
+    report("intlist reduce", per_element, now() - start, reduced == batch_reduced);
+
+    start = now();
+    IntVec vec_mapped = intvec_map(vec, triple);
+    per_element = now() - start;
+    start = now();
+    IntVec vec_batch_mapped = intvec_map_batch(vec, triple_batch, NULL);
+    report("intvec map", per_element, now() - start, intvec_equals(vec_mapped, vec_batch_mapped));
+
+    start = now();
+    reduced = intvec_reduce(vec, add, 0);
+    per_element = now() - start;
+    start = now();
+    batch_reduced = intvec_reduce_batch(vec, add_batch, 0, NULL);
+    report("intvec reduce", per_element, now() - start, reduced == batch_reduced);
+    return 0;
+}
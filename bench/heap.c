@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "heap/intheap.h"
+#include "linkedlist/intlist.h"
+
+#define SIZE 4000000
+#define LIST_SIZE 20000
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int sample(int i) {
+    return (int) (i * 2654435761u);
+}
+
+// Pushes every value one by one, then pops them all, checking the order on the way out
+static void push_pop(size_t arity) {
+    IntHeap heap = intheap_with_arity(arity, false);
+    if (!heap) return;
+
+    double start = now();
+    for (int i = 0; i < SIZE; i++) intheap_push(heap, sample(i));
+    double pushed = now() - start;
+
+    start = now();
+    bool ordered = true;
+    int last, value;
+    intheap_pop(heap, &last);
+    while (intheap_pop(heap, &value)) {
+        ordered = ordered && last <= value;
+        last = value;
+    }
+    printf("%-10zu%10.3fs%10.3fs%s\n", arity, pushed, now() - start, ordered ? "" : "  UNORDERED");
+}
+
+static void heapify(size_t arity, const int* values) {
+    IntHeap heap = intheap_with_arity(arity, false);
+    if (!heap) return;
+
+    double start = now();
+    intheap_push_n(heap, values, SIZE);
+    printf("%-10zu%10.3fs\n", arity, now() - start);
+}
+
+int main() {
+    printf("%d elements\n", SIZE);
+    printf("%-10s%11s%11s\n", "arity", "push", "pop");
+    for (size_t arity = 2; arity <= 16; arity *= 2) push_pop(arity);
+
+    int* values = (int*) malloc(sizeof (int) * SIZE);
+    if (!values) return 1;
+    for (int i = 0; i < SIZE; i++) values[i] = sample(i);
+
+    printf("%-10s%11s\n", "arity", "heapify");
+    for (size_t arity = 2; arity <= 16; arity *= 2) heapify(arity, values);
+    free(values);
+
+    // The approach the heap replaces: a sorted IntList kept in order with push_at, O(n) per insert
+    printf("\n%d elements, sorted IntList vs IntHeap\n", LIST_SIZE);
+    double start = now();
+    IntList list = intlist_new();
+    for (int i = 0; i < LIST_SIZE; i++) {
+        int value = sample(i), other;
+        size_t index = 0;
+        while (intlist_get_at(list, index, &other) && other < value) index++;
+        intlist_push_at(list, value, index);
+    }
+    double sorted = now() - start;
+
+    start = now();
+    IntHeap heap = intheap_new();
+    for (int i = 0; i < LIST_SIZE; i++) intheap_push(heap, sample(i));
+    printf("%-10s%10.3fs\n%-10s%10.3fs\n", "list", sorted, "heap", now() - start);
+    return 0;
+}
\ No newline at end of file
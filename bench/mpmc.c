@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include "queue/intqueue.h"
+#include "queue/intmpmcqueue.h"
+
+#define SIZE 8000000
+#define CAPACITY 4096
+#define BATCH 32
+#define MAX_THREADS 8
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static size_t threads;
+static long long sums[MAX_THREADS];
+
+// Baseline: a bounded IntQueue shared behind one mutex
+static IntQueue locked_queue;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void* locked_producer(void* arg) {
+    for (int i = 0; i < SIZE / (int) threads; ) {
+        pthread_mutex_lock(&lock);
+        bool sent = intqueue_enqueue(locked_queue, 1);
+        pthread_mutex_unlock(&lock);
+        if (sent) i++;
+        else sched_yield();
+    }
+    return NULL;
+}
+
+static void* locked_consumer(void* arg) {
+    long long sum = 0;
+    for (int i = 0, value; i < SIZE / (int) threads; ) {
+        pthread_mutex_lock(&lock);
+        bool got = intqueue_dequeue(locked_queue, &value);
+        pthread_mutex_unlock(&lock);
+        if (got) {
+            sum += value;
+            i++;
+        } else sched_yield();
+    }
+    sums[(long) arg] = sum;
+    return NULL;
+}
+
+static IntMpmcQueue mpmc_queue;
+
+static void* mpmc_producer(void* arg) {
+    for (int i = 0; i < SIZE / (int) threads; i++) intmpmcqueue_enqueue_wait(mpmc_queue, 1);
+    return NULL;
+}
+
+static void* mpmc_consumer(void* arg) {
+    long long sum = 0;
+    for (int i = 0, value; i < SIZE / (int) threads; i++) {
+        intmpmcqueue_dequeue_wait(mpmc_queue, &value);
+        sum += value;
+    }
+    sums[(long) arg] = sum;
+    return NULL;
+}
+
+static void* mpmc_batch_producer(void* arg) {
+    int batch[BATCH];
+    for (int i = 0; i < BATCH; i++) batch[i] = 1;
+
+    for (int i = 0, total = SIZE / (int) threads; i < total; ) {
+        size_t sent = intmpmcqueue_enqueue_n(mpmc_queue, batch, total - i < BATCH ? total - i : BATCH);
+        if (sent == 0) sched_yield();
+        i += sent;
+    }
+    return NULL;
+}
+
+static void* mpmc_batch_consumer(void* arg) {
+    long long sum = 0;
+    int batch[BATCH];
+    for (int i = 0, total = SIZE / (int) threads; i < total; ) {
+        size_t got = intmpmcqueue_dequeue_n(mpmc_queue, batch, total - i < BATCH ? total - i : BATCH);
+        if (got == 0) sched_yield();
+        for (size_t j = 0; j < got; j++) sum += batch[j];
+        i += got;
+    }
+    sums[(long) arg] = sum;
+    return NULL;
+}
+
+static double run(void* (*producer)(void*), void* (*consumer)(void*)) {
+    pthread_t producers[MAX_THREADS], consumers[MAX_THREADS];
+    double start = now();
+    for (long i = 0; i < (long) threads; i++) {
+        pthread_create(&producers[i], NULL, producer, (void*) i);
+        pthread_create(&consumers[i], NULL, consumer, (void*) i);
+    }
+    long long sum = 0;
+    for (size_t i = 0; i < threads; i++) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+        sum += sums[i];
+    }
+    double elapsed = now() - start;
+    return sum == SIZE / (long long) threads * threads ? SIZE / elapsed / 1e6 : -1;
+}
+
+int main() {
+    locked_queue = intqueue_new_bounded(CAPACITY);
+    mpmc_queue = intmpmcqueue_new(CAPACITY);
+    if (!locked_queue || !mpmc_queue) return 1;
+
+    printf("%d elements through a %d slot queue, online CPUs: %ld\n", SIZE, CAPACITY, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-20s%12s%12s%12s\n", "producers/consumers", "mutex M/s", "mpmc M/s", "batched M/s");
+
+    for (threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        double locked = run(locked_producer, locked_consumer);
+        double mpmc = run(mpmc_producer, mpmc_consumer);
+        double batched = run(mpmc_batch_producer, mpmc_batch_consumer);
+        printf("%-20zu%12.1f%12.1f%12.1f\n", threads, locked, mpmc, batched);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "linkedlist/intlist.h"
+#include "arraylist/intvec.h"
+
+#define SIZE 1000000
+#define WORK 200
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Stands in for an expensive per-element callback
+static int churn(int value) {
+    unsigned int x = (unsigned int) value;
+    for (int i = 0; i < WORK; i++) x = x * 1103515245u + 12345u;
+    return (int) (x >> 1);
+}
+
+static bool is_churned_even(int value) {
+    return churn(value) % 2 == 0;
+}
+
+static long long add_churned(long long acc, int value) {
+    return acc + churn(value) % 1000;
+}
+
+static long long combine(long long acc1, long long acc2) {
+    return acc1 + acc2;
+}
+
+static void report(const char* name, double sequential, double parallel, bool same) {
+    printf("%-20s%10.3fs%10.3fs  x%.2f%s\n", name, sequential, parallel, sequential / parallel, same ? "" : "  MISMATCH");
+}
+
+int main() {
+    IntList list = intlist_new();
+    IntVec vec = intvec_with_capacity(SIZE);
+    for (int i = 0; i < SIZE; i++) {
+        if (!intlist_push(list, i) || !intvec_push(vec, i)) return 1;
+    }
+
+    printf("%d elements, %d rounds of work per callback, online CPUs: %ld\n", SIZE, WORK, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-20s%11s%11s\n", "", "sequential", "parallel");
+
+    double start = now();
+    IntList mapped = intlist_map(list, churn);
+    double sequential = now() - start;
+    start = now();
+    IntList par_mapped = intlist_par_map(list, churn);
+    report("intlist map", sequential, now() - start, intlist_equals(mapped, par_mapped));
+
+    start = now();
+    IntList filtered = intlist_filter(list, is_churned_even);
+    sequential = now() - start;
+    start = now();
+    IntList par_filtered = intlist_par_filter(list, is_churned_even);
+    report("intlist filter", sequential, now() - start, intlist_equals(filtered, par_filtered));
+
+    start = now();
+    long long reduced = intlist_reduce(list, add_churned, 0);
+    sequential = now() - start;
+    start = now();
+    long long par_reduced = intlist_par_reduce(list, add_churned, combine, 0);
+    report("intlist reduce", sequential, now() - start, reduced == par_reduced);
+
+    start = now();
+    IntVec vec_mapped = intvec_map(vec, churn);
+    sequential = now() - start;
+    start = now();
+    IntVec vec_par_mapped = intvec_par_map(vec, churn);
+    report("intvec map", sequential, now() - start, intvec_equals(vec_mapped, vec_par_mapped));
+
+    start = now();
+    IntVec vec_filtered = intvec_filter(vec, is_churned_even);
+    sequential = now() - start;
+    start = now();
+    IntVec vec_par_filtered = intvec_par_filter(vec, is_churned_even);
+    report("intvec filter", sequential, now() - start, intvec_equals(vec_filtered, vec_par_filtered));
+
+    start = now();
+    reduced = intvec_reduce(vec, add_churned, 0);
+    sequential = now() - start;
+    start = now();
+    par_reduced = intvec_par_reduce(vec, add_churned, combine, 0);
+    report("intvec reduce", sequential, now() - start, reduced == par_reduced);
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "internal/simd.h"
+
+#define SMALL_SIZE 4096
+#define LARGE_SIZE (1 << 22)
+#define TOTAL_ELEMENTS (1 << 28)
+
+typedef struct {
+    const char* name;
+    long long (*run)(const int* arr, const int* other, const char* bytes, size_t size);
+} Kernel;
+
+static long long run_sum(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_sum_int(arr, size); }
+static long long run_min(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_min_int(arr, size); }
+static long long run_max(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_max_int(arr, size); }
+static long long run_count(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_count_int(arr, size, 7); }
+static long long run_find(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_find_int(arr, size, -1); }
+static long long run_equals(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_equals_int(arr, other, size); }
+// Byte kernels scan the same number of bytes as the int kernels do
+static long long run_count_byte(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_count_byte(bytes, size * sizeof (int), '\n'); }
+static long long run_find_byte(const int* arr, const int* other, const char* bytes, size_t size) { return _simd_find_byte(bytes, size * sizeof (int), '\0'); }
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Returns the best time per pass over the input, so a noisy run does not skew the comparison
+static double measure(const Kernel* kernel, const int* arr, const int* other, const char* bytes, size_t size, long long* result) {
+    size_t passes = TOTAL_ELEMENTS / size;
+    double best = 0;
+    for (int round = 0; round < 3; round++) {
+        double start = now();
+        for (size_t i = 0; i < passes; i++) {
+            *result = kernel->run(arr, other, bytes, size);
+            __asm__ volatile("" ::: "memory");
+        }
+        double elapsed = (now() - start) / passes;
+        if (round == 0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+int main() {
+    Kernel kernels[] = {
+        {"sum", run_sum},
+        {"min", run_min},
+        {"max", run_max},
+        {"count", run_count},
+        {"find", run_find},
+        {"equals", run_equals},
+        {"count_byte", run_count_byte},
+        {"find_byte", run_find_byte},
+    };
+    size_t kernels_num = sizeof (kernels) / sizeof (kernels[0]);
+    size_t sizes[] = {SMALL_SIZE, LARGE_SIZE};
+
+    int* arr = malloc(sizeof (int) * LARGE_SIZE);
+    int* other = malloc(sizeof (int) * LARGE_SIZE);
+    char* bytes = malloc(sizeof (int) * LARGE_SIZE);
+    if (!arr || !other || !bytes) return 1;
+
+    srand(42);
+    for (size_t i = 0; i < LARGE_SIZE; i++) arr[i] = other[i] = rand() % 1000;
+    for (size_t i = 0; i < sizeof (int) * LARGE_SIZE; i++) bytes[i] = rand() % 64 == 0 ? '\n' : 'a' + rand() % 26;
+
+    SimdLevel best = _simd_level();
+    printf("SIMD kernels (selected at load time: %s)\n", _simd_level_name(best));
+
+    for (size_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++) {
+        printf("\n%zu elements\n%-12s", sizes[s], "kernel");
+        for (SimdLevel level = SIMD_SCALAR; level <= SIMD_AVX512; level++) {
+            if (_simd_select(level)) printf("%16s", _simd_level_name(level));
+        }
+        printf("\n");
+
+        for (size_t k = 0; k < kernels_num; k++) {
+            printf("%-12s", kernels[k].name);
+
+            double baseline = 0;
+            long long expected = 0, result = 0;
+            for (SimdLevel level = SIMD_SCALAR; level <= SIMD_AVX512; level++) {
+                if (!_simd_select(level)) continue;
+
+                double elapsed = measure(&kernels[k], arr, other, bytes, sizes[s], &result);
+                if (level == SIMD_SCALAR) baseline = elapsed, expected = result;
+
+                if (result != expected) {
+                    printf("\n%s: %s result %lld differs from scalar %lld\n", kernels[k].name, _simd_level_name(level), result, expected);
+                    return 1;
+                }
+                printf("%9.2fns x%-4.1f", elapsed * 1e9 / sizes[s], baseline / elapsed);
+            }
+            printf("\n");
+        }
+    }
+    printf("\n(time per element, speedup over scalar)\n");
+
+    _simd_select(best);
+    free(arr);
+    free(other);
+    free(bytes);
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linkedlist/intlist.h"
+
+#define SIZE 1000000
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int compare_ints(const void* a, const void* b) {
+    int x = *(const int*) a, y = *(const int*) b;
+    return (x > y) - (x < y);
+}
+
+static int compare_values(int a, int b, void* ctx) {
+    return (a > b) - (a < b);
+}
+
+int main() {
+    int* arr = malloc(sizeof (int) * SIZE);
+    if (!arr) return 1;
+
+    srand(42);
+    for (size_t i = 0; i < SIZE; i++) arr[i] = rand() - RAND_MAX / 2;
+
+    printf("Sorting %d random ints\n", SIZE);
+
+    // The previous workaround: export, qsort, rebuild
+    IntList list = intlist_from_array(arr, SIZE);
+    double start = now();
+    int* exported = intlist_to_array(list);
+    qsort(exported, SIZE, sizeof (int), compare_ints);
+    IntList rebuilt = intlist_from_array(exported, SIZE);
+    double baseline = now() - start;
+    printf("%-28s%8.3fs\n", "to_array + qsort + rebuild", baseline);
+
+    list = intlist_from_array(arr, SIZE);
+    start = now();
+    intlist_sort_by(list, compare_values, NULL);
+    double elapsed = now() - start;
+    printf("%-28s%8.3fs x%.1f\n", "intlist_sort_by (merge)", elapsed, baseline / elapsed);
+    if (!intlist_equals(list, rebuilt)) return 1;
+
+    list = intlist_from_array(arr, SIZE);
+    start = now();
+    intlist_sort(list);
+    elapsed = now() - start;
+    printf("%-28s%8.3fs x%.1f\n", "intlist_sort (radix)", elapsed, baseline / elapsed);
+    if (!intlist_equals(list, rebuilt)) return 1;
+
+    free(arr);
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "queue/intqueue.h"
+#include "queue/intspscqueue.h"
+
+#define SIZE 20000000
+#define CAPACITY 4096
+#define BATCH 64
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Baseline: the handoff the ingest pipeline used, an IntQueue behind one mutex
+static IntQueue locked_queue;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void* locked_producer(void* arg) {
+    for (int i = 0; i < SIZE; ) {
+        pthread_mutex_lock(&lock);
+        bool sent = intqueue_enqueue(locked_queue, i);
+        pthread_mutex_unlock(&lock);
+        if (sent) i++;
+        else sched_yield();
+    }
+    return NULL;
+}
+
+static long long locked_consume(void) {
+    long long sum = 0;
+    for (int i = 0, value; i < SIZE; ) {
+        pthread_mutex_lock(&lock);
+        bool got = intqueue_dequeue(locked_queue, &value);
+        pthread_mutex_unlock(&lock);
+        if (got) {
+            sum += value;
+            i++;
+        } else sched_yield();
+    }
+    return sum;
+}
+
+static IntSpscQueue spsc_queue;
+
+static void* spsc_producer(void* arg) {
+    for (int i = 0; i < SIZE; ) {
+        if (intspscqueue_enqueue(spsc_queue, i)) i++;
+        else sched_yield();
+    }
+    return NULL;
+}
+
+static long long spsc_consume(void) {
+    long long sum = 0;
+    for (int i = 0, value; i < SIZE; ) {
+        if (intspscqueue_dequeue(spsc_queue, &value)) {
+            sum += value;
+            i++;
+        } else sched_yield();
+    }
+    return sum;
+}
+
+static void* spsc_batch_producer(void* arg) {
+    int batch[BATCH];
+    for (int i = 0; i < SIZE; ) {
+        int size = SIZE - i < BATCH ? SIZE - i : BATCH;
+        for (int j = 0; j < size; j++) batch[j] = i + j;
+
+        size_t sent = intspscqueue_enqueue_n(spsc_queue, batch, size);
+        if (sent == 0) sched_yield();
+        i += sent;
+    }
+    return NULL;
+}
+
+static long long spsc_batch_consume(void) {
+    long long sum = 0;
+    int batch[BATCH];
+    for (int i = 0; i < SIZE; ) {
+        size_t got = intspscqueue_dequeue_n(spsc_queue, batch, BATCH);
+        if (got == 0) sched_yield();
+        for (size_t j = 0; j < got; j++) sum += batch[j];
+        i += got;
+    }
+    return sum;
+}
+
+static void run(const char* name, void* (*producer)(void*), long long (*consume)(void)) {
+    pthread_t thread;
+    double start = now();
+    if (pthread_create(&thread, NULL, producer, NULL) != 0) return;
+    long long sum = consume();
+    pthread_join(thread, NULL);
+    double elapsed = now() - start;
+
+    bool same = sum == (long long) SIZE * (SIZE - 1) / 2;
+    printf("%-20s%10.3fs%10.1f M/s%s\n", name, elapsed, SIZE / elapsed / 1e6, same ? "" : "  MISMATCH");
+}
+
+int main() {
+    locked_queue = intqueue_new_bounded(CAPACITY);
+    spsc_queue = intspscqueue_new(CAPACITY);
+    if (!locked_queue || !spsc_queue) return 1;
+
+    printf("%d elements through a %d slot queue\n", SIZE, CAPACITY);
+    run("mutex + IntQueue", locked_producer, locked_consume);
+    run("spsc", spsc_producer, spsc_consume);
+    run("spsc batched", spsc_batch_producer, spsc_batch_consume);
+    return 0;
+}
\ No newline at end of file
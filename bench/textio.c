@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <time.h>
+#include "linkedlist/intlist.h"
+
+#define SIZE 10000000
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Spread over the whole int range, so numbers of every width show up
+static int sample(int i) {
+    return (int) (i * 2654435761u);
+}
+
+static void report(const char* name, double stdio, double buffered, bool same) {
+    printf("%-20s%10.3fs%10.3fs  x%.2f%s\n", name, stdio, buffered, stdio / buffered, same ? "" : "  MISMATCH");
+}
+
+int main() {
+    IntList list = intlist_new();
+    for (int i = 0; i < SIZE; i++) {
+        if (!intlist_push(list, sample(i))) return 1;
+    }
+
+    FILE* file = tmpfile();
+    if (!file) return 1;
+
+    printf("%d elements\n", SIZE);
+    printf("%-20s%11s%11s\n", "", "stdio", "buffered");
+
+    // Baseline: one fprintf per element, as intlist_print used to do
+    double start = now();
+    for (int i = 0; i < SIZE; i++) fprintf(file, "%d\n", sample(i));
+    fflush(file);
+    double stdio = now() - start;
+    long stdio_size = ftell(file);
+
+    rewind(file);
+    start = now();
+    bool written = intlist_write(list, file, "\n");
+    report("write", stdio, now() - start, written && ftell(file) == stdio_size - 1);
+
+    rewind(file);
+    start = now();
+    IntList scanned = intlist_new();
+    for (int value; fscanf(file, "%d", &value) == 1; ) intlist_push(scanned, value);
+    stdio = now() - start;
+
+    rewind(file);
+    start = now();
+    IntList parsed = intlist_read(file);
+    report("read", stdio, now() - start, intlist_equals(parsed, list) && intlist_equals(scanned, list));
+    return 0;
+}
@@ -0,0 +1,66 @@
+#ifndef INTVEC_H
+#define INTVEC_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intstack* IntStack;
+typedef struct _intqueue* IntQueue;
+
+typedef struct _intvec* IntVec;
+
+IntVec intvec_new(void);
+IntVec intvec_with_capacity(size_t capacity);
+IntVec intvec_from_array(const int* arr, size_t size);
+void intvec_clear(IntVec vec);
+
+bool intvec_reserve(IntVec vec, size_t capacity);
+bool intvec_shrink_to_fit(IntVec vec);
+
+bool intvec_push_at(IntVec vec, int value, size_t index);
+bool intvec_push(IntVec vec, int value);
+bool intvec_append_array(IntVec vec, const int* arr, size_t size);
+
+void intvec_pop_at(IntVec vec, size_t index);
+void intvec_pop(IntVec vec);
+
+bool intvec_is_empty(const IntVec vec);
+size_t intvec_size(const IntVec vec);
+size_t intvec_capacity(const IntVec vec);
+bool intvec_front(const IntVec vec, int* out);
+bool intvec_get_at(const IntVec vec, size_t index, int* out);
+bool intvec_set_at(IntVec vec, size_t index, int value);
+bool intvec_back(const IntVec vec, int* out);
+int intvec_index(const IntVec vec, int target);
+size_t intvec_count(const IntVec vec, int target);
+bool intvec_contains(const IntVec vec, int target);
+bool intvec_equals(const IntVec vec1, const IntVec vec2);
+
+IntVec intvec_copy(const IntVec vec);
+IntVec intvec_map(const IntVec vec, int (*callback_func)(int value));
+IntVec intvec_filter(const IntVec vec, bool (*predicate_func)(int value));
+IntVec intvec_zip(const IntVec vec1, const IntVec vec2);
+int* intvec_to_array(const IntVec vec);
+IntList intvec_to_list(const IntVec vec);
+IntStack intvec_to_stack(const IntVec vec);
+IntQueue intvec_to_queue(const IntVec vec);
+
+void intvec_reverse(IntVec vec);
+void intvec_foreach(IntVec vec, int (*callback_func)(int value));
+long long intvec_reduce(const IntVec vec, long long (*reduce_func)(long long acc, int value), long long initial);
+void intvec_foreach_batch(IntVec vec, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx);
+IntVec intvec_map_batch(const IntVec vec, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx);
+IntVec intvec_filter_batch(const IntVec vec, void (*batch_func)(const int* values, bool* keep, size_t size, void* ctx), void* ctx);
+long long intvec_reduce_batch(const IntVec vec, long long (*batch_func)(long long acc, const int* values, size_t size, void* ctx), long long initial, void* ctx);
+bool intvec_any(const IntVec vec, bool (*predicate_func)(int value));
+bool intvec_all(const IntVec vec, bool (*predicate_func)(int value));
+long long intvec_sum(const IntVec vec);
+bool intvec_min(const IntVec vec, int* out);
+bool intvec_max(const IntVec vec, int* out);
+IntVec intvec_par_map(const IntVec vec, int (*callback_func)(int value));
+IntVec intvec_par_filter(const IntVec vec, bool (*predicate_func)(int value));
+long long intvec_par_reduce(const IntVec vec, long long (*reduce_func)(long long acc, int value), long long (*combine_func)(long long acc1, long long acc2), long long identity);
+void intvec_print(const IntVec vec);
+
+#endif // INTVEC_H
@@ -0,0 +1,27 @@
+#ifndef INTHEAP_H
+#define INTHEAP_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intheap* IntHeap;
+
+IntHeap intheap_new(void);
+IntHeap intheap_new_max(void);
+IntHeap intheap_with_arity(size_t arity, bool max);
+IntHeap intheap_from_array(const int* arr, size_t size);
+IntHeap intheap_from_array_with(const int* arr, size_t size, size_t arity, bool max);
+void intheap_clear(IntHeap heap);
+bool intheap_reserve(IntHeap heap, size_t capacity);
+
+bool intheap_push(IntHeap heap, int value);
+bool intheap_push_n(IntHeap heap, const int* arr, size_t size);
+bool intheap_pop(IntHeap heap, int* out);
+bool intheap_peek(const IntHeap heap, int* out);
+
+bool intheap_is_empty(const IntHeap heap);
+size_t intheap_size(const IntHeap heap);
+size_t intheap_capacity(const IntHeap heap);
+size_t intheap_arity(const IntHeap heap);
+
+#endif // INTHEAP_H
\ No newline at end of file
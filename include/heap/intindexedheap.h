@@ -0,0 +1,28 @@
+#ifndef INTINDEXEDHEAP_H
+#define INTINDEXEDHEAP_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#define INTINDEXEDHEAP_ID_LIMIT ((size_t) 1 << 26) // Ids index a table sized to the largest one, so they must be small dense integers below this
+
+typedef struct _intindexedheap* IntIndexedHeap;
+
+IntIndexedHeap intindexedheap_new(void);
+IntIndexedHeap intindexedheap_new_max(void);
+void intindexedheap_clear(IntIndexedHeap heap);
+
+bool intindexedheap_push(IntIndexedHeap heap, size_t id, int priority);
+bool intindexedheap_pop(IntIndexedHeap heap, size_t* id, int* priority);
+bool intindexedheap_peek(const IntIndexedHeap heap, size_t* id, int* priority);
+bool intindexedheap_remove(IntIndexedHeap heap, size_t id);
+
+bool intindexedheap_contains(const IntIndexedHeap heap, size_t id);
+bool intindexedheap_priority(const IntIndexedHeap heap, size_t id, int* out);
+bool intindexedheap_decrease_key(IntIndexedHeap heap, size_t id, int priority);
+bool intindexedheap_update(IntIndexedHeap heap, size_t id, int priority);
+
+bool intindexedheap_is_empty(const IntIndexedHeap heap);
+size_t intindexedheap_size(const IntIndexedHeap heap);
+
+#endif // INTINDEXEDHEAP_H
\ No newline at end of file
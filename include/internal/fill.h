@@ -0,0 +1,26 @@
+#ifndef FILL_H
+#define FILL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intstack* IntStack;
+typedef struct _intqueue* IntQueue;
+
+// Sizes an empty container to count values and returns its storage in container order (bottom to top, front to back),
+// so a conversion writes straight into it while walking its source
+int* _intstack_fill(IntStack stack, size_t count);
+int* _intqueue_fill(IntQueue queue, size_t count);
+
+// Hands an array of capacity ints holding size values bottom to top over to an empty stack
+void _intstack_adopt(IntStack stack, int* data, size_t capacity, size_t size);
+
+// Hands an array of capacity ints holding size values front to back over to an empty queue as its ring; the ring is the
+// largest power of two that fits in the array, and the array is only reallocated when that would not hold size values
+bool _intqueue_adopt(IntQueue queue, int* data, size_t capacity, size_t size);
+
+// Appends arr from its last value to its first, for sources that keep their front at the end of an array
+bool _intlist_push_reversed(IntList list, const int* arr, size_t size);
+
+#endif // FILL_H
@@ -0,0 +1,20 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// Fixed-size node allocator created for a single list: nodes are carved out of aligned slabs, each with its own free
+// list and count of live nodes, and a slab goes back to the system once none of its nodes are in use.
+// A node always returns to the slab it was carved from, whichever list frees it, so nodes can be relinked between
+// lists (splice, split) without copying. Lists that have exchanged nodes share slabs and must stay on one thread.
+typedef struct _nodepool* NodePool;
+
+NodePool _nodepool_new(size_t node_size);
+void* _nodepool_alloc(NodePool pool);
+bool _nodepool_reserve(NodePool pool, size_t count);
+void _nodepool_free(void* node);
+void _nodepool_release(NodePool pool);
+void _nodepool_destroy(NodePool pool);
+
+#endif // NODE_POOL_H
@@ -0,0 +1,28 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef enum {
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_AVX2,
+    SIMD_AVX512,
+} SimdLevel;
+
+// Kernels over contiguous storage, dispatched at load time to the widest instruction set the CPU supports
+long long _simd_sum_int(const int* arr, size_t size);
+int _simd_min_int(const int* arr, size_t size);
+int _simd_max_int(const int* arr, size_t size);
+size_t _simd_count_int(const int* arr, size_t size, int target);
+size_t _simd_find_int(const int* arr, size_t size, int target);
+bool _simd_equals_int(const int* arr1, const int* arr2, size_t size);
+size_t _simd_count_byte(const char* arr, size_t size, char target);
+size_t _simd_find_byte(const char* arr, size_t size, char target);
+
+SimdLevel _simd_level(void);
+bool _simd_select(SimdLevel level);
+const char* _simd_level_name(SimdLevel level);
+
+#endif // SIMD_H
@@ -0,0 +1,27 @@
+#ifndef TEXTIO_H
+#define TEXTIO_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TEXTIO_BUFFER_SIZE 65536
+#define TEXTIO_INT_MAX_LEN 11
+
+// Accumulates output and hands it to stdio in large blocks; ok turns false once any write fails
+typedef struct _textwriter {
+    FILE* stream;
+    size_t used;
+    bool ok;
+    char data[TEXTIO_BUFFER_SIZE];
+} TextWriter;
+
+// Writes the decimal form of value without a terminator and returns its length, at most TEXTIO_INT_MAX_LEN
+size_t _textio_format_int(int value, char* out);
+
+void _textio_writer_init(TextWriter* writer, FILE* stream);
+void _textio_write(TextWriter* writer, const char* data, size_t size);
+void _textio_write_int(TextWriter* writer, int value);
+bool _textio_flush(TextWriter* writer);
+
+#endif // TEXTIO_H
@@ -0,0 +1,14 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+
+// Inputs smaller than this are processed sequentially, where thread handoff would cost more than it saves
+#define PAR_SEQUENTIAL_CUTOFF 4096
+#define PAR_MIN_CHUNK 1024
+
+size_t _threadpool_threads(void);
+size_t _threadpool_chunks(size_t size);
+void _threadpool_run(void (*task)(void* arg, size_t index), void* arg, size_t tasks);
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,17 @@
+#ifndef VISIT_H
+#define VISIT_H
+
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intvec* IntVec;
+typedef struct _intqueue* IntQueue;
+
+// Feeds every value to visit_func in container order, stopping early once it returns false
+typedef bool (*IntVisitor)(int value, void* ctx);
+
+void _intlist_visit(const IntList list, IntVisitor visit_func, void* ctx);
+void _intvec_visit(const IntVec vec, IntVisitor visit_func, void* ctx);
+void _intqueue_visit(const IntQueue queue, IntVisitor visit_func, void* ctx);
+
+#endif // VISIT_H
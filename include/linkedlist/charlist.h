@@ -16,6 +16,10 @@ void charlist_clear(CharList list);
 bool charlist_push_front(CharList list, char value);
 bool charlist_push_at(CharList list, char value, size_t index);
 bool charlist_push(CharList list, char value);
+bool charlist_append_str(CharList list, const char* str);
+bool charlist_concat(CharList dst, CharList src);
+bool charlist_splice(CharList dst, size_t pos, CharList src);
+CharList charlist_split_at(CharList list, size_t index);
 
 void charlist_pop_front(CharList list);
 void charlist_pop_at(CharList list, size_t index);
@@ -40,6 +44,8 @@ CharStack charlist_to_stack(const CharList list);
 CharQueue charlist_to_queue(const CharList list);
 
 void charlist_reverse(CharList list);
+void charlist_sort(CharList list);
+void charlist_sort_by(CharList list, int (*compare_func)(char a, char b, void* ctx), void* ctx);
 void charlist_foreach(CharList list, char (*callback_func)(char value));
 long long charlist_reduce(const CharList list, long long (*reduce_func)(long long acc, char value), long long initial);
 bool charlist_any(const CharList list, bool (*predicate_func)(char value));
@@ -0,0 +1,52 @@
+#ifndef INTCHUNKLIST_H
+#define INTCHUNKLIST_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intstack* IntStack;
+typedef struct _intqueue* IntQueue;
+
+typedef struct _intchunklist* IntChunkList;
+
+IntChunkList intchunklist_new(void);
+IntChunkList intchunklist_from_array(int* arr, size_t size);
+void intchunklist_clear(IntChunkList list);
+
+bool intchunklist_push_front(IntChunkList list, int value);
+bool intchunklist_push_at(IntChunkList list, int value, size_t index);
+bool intchunklist_push(IntChunkList list, int value);
+
+void intchunklist_pop_front(IntChunkList list);
+void intchunklist_pop_at(IntChunkList list, size_t index);
+void intchunklist_pop(IntChunkList list);
+
+bool intchunklist_is_empty(const IntChunkList list);
+size_t intchunklist_size(const IntChunkList list);
+bool intchunklist_front(const IntChunkList list, int* out);
+bool intchunklist_get_at(const IntChunkList list, size_t index, int* out);
+bool intchunklist_back(const IntChunkList list, int* out);
+int intchunklist_index(const IntChunkList list, int target);
+size_t intchunklist_count(const IntChunkList list, int target);
+bool intchunklist_contains(const IntChunkList list, int target);
+bool intchunklist_equals(const IntChunkList list1, const IntChunkList list2);
+
+IntChunkList intchunklist_copy(const IntChunkList list);
+IntChunkList intchunklist_map(const IntChunkList list, int (*callback_func)(int value));
+IntChunkList intchunklist_filter(const IntChunkList list, bool (*predicate_func)(int value));
+IntChunkList intchunklist_zip(const IntChunkList list1, const IntChunkList list2);
+int* intchunklist_to_array(const IntChunkList list);
+IntList intchunklist_to_list(const IntChunkList list);
+IntStack intchunklist_to_stack(const IntChunkList list);
+IntQueue intchunklist_to_queue(const IntChunkList list);
+
+void intchunklist_reverse(IntChunkList list);
+void intchunklist_foreach(IntChunkList list, int (*callback_func)(int value));
+long long intchunklist_reduce(const IntChunkList list, long long (*reduce_func)(long long acc, int value), long long initial);
+bool intchunklist_any(const IntChunkList list, bool (*predicate_func)(int value));
+bool intchunklist_all(const IntChunkList list, bool (*predicate_func)(int value));
+long long intchunklist_sum(const IntChunkList list);
+void intchunklist_print(const IntChunkList list);
+
+#endif // INTCHUNKLIST_H
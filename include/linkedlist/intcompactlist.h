@@ -0,0 +1,57 @@
+#ifndef INTCOMPACTLIST_H
+#define INTCOMPACTLIST_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intstack* IntStack;
+typedef struct _intqueue* IntQueue;
+
+typedef struct _intcompactlist* IntCompactList;
+
+IntCompactList intcompactlist_new(void);
+IntCompactList intcompactlist_with_capacity(size_t capacity);
+IntCompactList intcompactlist_from_array(int* arr, size_t size);
+void intcompactlist_clear(IntCompactList list);
+bool intcompactlist_reserve(IntCompactList list, size_t capacity);
+bool intcompactlist_shrink_to_fit(IntCompactList list);
+size_t intcompactlist_capacity(const IntCompactList list);
+
+bool intcompactlist_push_front(IntCompactList list, int value);
+bool intcompactlist_push_at(IntCompactList list, int value, size_t index);
+bool intcompactlist_push(IntCompactList list, int value);
+
+void intcompactlist_pop_front(IntCompactList list);
+void intcompactlist_pop_at(IntCompactList list, size_t index);
+void intcompactlist_pop(IntCompactList list);
+
+bool intcompactlist_is_empty(const IntCompactList list);
+size_t intcompactlist_size(const IntCompactList list);
+bool intcompactlist_front(const IntCompactList list, int* out);
+bool intcompactlist_get_at(const IntCompactList list, size_t index, int* out);
+bool intcompactlist_set_at(IntCompactList list, size_t index, int value);
+bool intcompactlist_back(const IntCompactList list, int* out);
+int intcompactlist_index(const IntCompactList list, int target);
+size_t intcompactlist_count(const IntCompactList list, int target);
+bool intcompactlist_contains(const IntCompactList list, int target);
+bool intcompactlist_equals(const IntCompactList list1, const IntCompactList list2);
+
+IntCompactList intcompactlist_copy(const IntCompactList list);
+IntCompactList intcompactlist_map(const IntCompactList list, int (*callback_func)(int value));
+IntCompactList intcompactlist_filter(const IntCompactList list, bool (*predicate_func)(int value));
+IntCompactList intcompactlist_zip(const IntCompactList list1, const IntCompactList list2);
+int* intcompactlist_to_array(const IntCompactList list);
+IntList intcompactlist_to_list(const IntCompactList list);
+IntStack intcompactlist_to_stack(const IntCompactList list);
+IntQueue intcompactlist_to_queue(const IntCompactList list);
+
+void intcompactlist_reverse(IntCompactList list);
+void intcompactlist_foreach(IntCompactList list, int (*callback_func)(int value));
+long long intcompactlist_reduce(const IntCompactList list, long long (*reduce_func)(long long acc, int value), long long initial);
+bool intcompactlist_any(const IntCompactList list, bool (*predicate_func)(int value));
+bool intcompactlist_all(const IntCompactList list, bool (*predicate_func)(int value));
+long long intcompactlist_sum(const IntCompactList list);
+void intcompactlist_print(const IntCompactList list);
+
+#endif // INTCOMPACTLIST_H
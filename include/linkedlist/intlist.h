@@ -1,13 +1,16 @@
 #ifndef INTLIST_H
 #define INTLIST_H
 
+#include <stdio.h>
 #include <stddef.h>
 #include <stdbool.h>
 
 typedef struct _intstack* IntStack;
 typedef struct _intqueue* IntQueue;
+typedef struct _intdeque* IntDeque;
 
 typedef struct _intlist* IntList;
+typedef struct _intlistcursor* IntListCursor;
 
 IntList intlist_new(void);
 IntList intlist_from_array(int* arr, size_t size);
@@ -16,6 +19,11 @@ void intlist_clear(IntList list);
 bool intlist_push_front(IntList list, int value);
 bool intlist_push_at(IntList list, int value, size_t index);
 bool intlist_push(IntList list, int value);
+bool intlist_push_n(IntList list, const int* arr, size_t size);
+bool intlist_extend(IntList list, const IntList other);
+bool intlist_concat(IntList dst, IntList src);
+bool intlist_splice(IntList dst, size_t pos, IntList src);
+IntList intlist_split_at(IntList list, size_t index);
 
 void intlist_pop_front(IntList list);
 void intlist_pop_at(IntList list, size_t index);
@@ -38,13 +46,39 @@ IntList intlist_zip(const IntList list1, const IntList list2);
 int* intlist_to_array(const IntList list);
 IntStack intlist_to_stack(const IntList list);
 IntQueue intlist_to_queue(const IntList list);
+IntDeque intlist_to_deque(const IntList list);
+IntStack intlist_into_stack(IntList list);
+IntQueue intlist_into_queue(IntList list);
 
 void intlist_reverse(IntList list);
+void intlist_sort(IntList list);
+void intlist_sort_by(IntList list, int (*compare_func)(int a, int b, void* ctx), void* ctx);
 void intlist_foreach(IntList list, int (*callback_func)(int value));
 long long intlist_reduce(const IntList list, long long (*reduce_func)(long long acc, int value), long long initial);
+void intlist_foreach_batch(IntList list, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx);
+IntList intlist_map_batch(const IntList list, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx);
+IntList intlist_filter_batch(const IntList list, void (*batch_func)(const int* values, bool* keep, size_t size, void* ctx), void* ctx);
+long long intlist_reduce_batch(const IntList list, long long (*batch_func)(long long acc, const int* values, size_t size, void* ctx), long long initial, void* ctx);
 bool intlist_any(const IntList list, bool (*predicate_func)(int value));
 bool intlist_all(const IntList list, bool (*predicate_func)(int value));
 long long intlist_sum(const IntList list);
+IntList intlist_par_map(const IntList list, int (*callback_func)(int value));
+IntList intlist_par_filter(const IntList list, bool (*predicate_func)(int value));
+long long intlist_par_reduce(const IntList list, long long (*reduce_func)(long long acc, int value), long long (*combine_func)(long long acc1, long long acc2), long long identity);
 void intlist_print(const IntList list);
+bool intlist_write(const IntList list, FILE* stream, const char* sep);
+size_t intlist_format_into(const IntList list, char* buf, size_t size, const char* sep);
+IntList intlist_read(FILE* stream);
+
+IntListCursor intlist_cursor_new(IntList list);
+bool intlist_cursor_is_valid(const IntListCursor cursor);
+size_t intlist_cursor_index(const IntListCursor cursor);
+bool intlist_cursor_next(IntListCursor cursor);
+bool intlist_cursor_prev(IntListCursor cursor);
+bool intlist_cursor_seek(IntListCursor cursor, size_t index);
+bool intlist_cursor_get(const IntListCursor cursor, int* out);
+bool intlist_cursor_set(IntListCursor cursor, int value);
+bool intlist_cursor_insert(IntListCursor cursor, int value);
+bool intlist_cursor_remove(IntListCursor cursor);
 
 #endif // INTLIST_H
\ No newline at end of file
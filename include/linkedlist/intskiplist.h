@@ -0,0 +1,53 @@
+#ifndef INTSKIPLIST_H
+#define INTSKIPLIST_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intstack* IntStack;
+typedef struct _intqueue* IntQueue;
+
+typedef struct _intskiplist* IntSkipList;
+
+IntSkipList intskiplist_new(void);
+IntSkipList intskiplist_from_array(int* arr, size_t size);
+void intskiplist_clear(IntSkipList list);
+
+bool intskiplist_push_front(IntSkipList list, int value);
+bool intskiplist_push_at(IntSkipList list, int value, size_t index);
+bool intskiplist_push(IntSkipList list, int value);
+
+void intskiplist_pop_front(IntSkipList list);
+void intskiplist_pop_at(IntSkipList list, size_t index);
+void intskiplist_pop(IntSkipList list);
+
+bool intskiplist_is_empty(const IntSkipList list);
+size_t intskiplist_size(const IntSkipList list);
+bool intskiplist_front(const IntSkipList list, int* out);
+bool intskiplist_get_at(const IntSkipList list, size_t index, int* out);
+bool intskiplist_set_at(IntSkipList list, size_t index, int value);
+bool intskiplist_back(const IntSkipList list, int* out);
+int intskiplist_index(const IntSkipList list, int target);
+size_t intskiplist_count(const IntSkipList list, int target);
+bool intskiplist_contains(const IntSkipList list, int target);
+bool intskiplist_equals(const IntSkipList list1, const IntSkipList list2);
+
+IntSkipList intskiplist_copy(const IntSkipList list);
+IntSkipList intskiplist_map(const IntSkipList list, int (*callback_func)(int value));
+IntSkipList intskiplist_filter(const IntSkipList list, bool (*predicate_func)(int value));
+IntSkipList intskiplist_zip(const IntSkipList list1, const IntSkipList list2);
+int* intskiplist_to_array(const IntSkipList list);
+IntList intskiplist_to_list(const IntSkipList list);
+IntStack intskiplist_to_stack(const IntSkipList list);
+IntQueue intskiplist_to_queue(const IntSkipList list);
+
+void intskiplist_reverse(IntSkipList list);
+void intskiplist_foreach(IntSkipList list, int (*callback_func)(int value));
+long long intskiplist_reduce(const IntSkipList list, long long (*reduce_func)(long long acc, int value), long long initial);
+bool intskiplist_any(const IntSkipList list, bool (*predicate_func)(int value));
+bool intskiplist_all(const IntSkipList list, bool (*predicate_func)(int value));
+long long intskiplist_sum(const IntSkipList list);
+void intskiplist_print(const IntSkipList list);
+
+#endif // INTSKIPLIST_H
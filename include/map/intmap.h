@@ -10,6 +10,19 @@ typedef struct keyvaluepair {
     int value;
 } KeyValuePair;
 
+#define INTMAP_STATS_HISTOGRAM_SIZE 8
+
+typedef struct intmapstats {
+    uint32_t capacity;
+    uint32_t size;
+    double load_factor;
+    uint32_t chain_histogram[INTMAP_STATS_HISTOGRAM_SIZE]; // Buckets holding 0, 1, ..., 6 and 7 or more entries
+    uint32_t max_chain;
+    double empty_bucket_ratio;
+    uint32_t resize_count;
+    size_t bytes_used;
+} IntMapStats;
+
 typedef struct _intmapiter* IntMapIter;
 typedef struct _intmap* IntMap;
 
@@ -21,12 +34,18 @@ bool intmap_get(const IntMap map, const char* key, int* out);
 bool intmap_set(IntMap map, const char* key, int new_value);
 void intmap_remove(IntMap map, const char* key);
 
+uint32_t intmap_hash_key(const char* key);
+bool intmap_insert_hashed(IntMap map, const char* key, uint32_t hash, int value);
+bool intmap_get_hashed(const IntMap map, const char* key, uint32_t hash, int* out);
+void intmap_remove_hashed(IntMap map, const char* key, uint32_t hash);
+
 bool intmap_is_empty(const IntMap map);
 char** intmap_keys(const IntMap map);
 int* intmap_values(const IntMap map);
 bool intmap_has_key(const IntMap map, const char* key);
 bool intmap_equals(const IntMap map1, const IntMap map2);
 uint32_t intmap_size(const IntMap map);
+bool intmap_stats(const IntMap map, IntMapStats* out);
 
 IntMapIter intmap_iter_new(const IntMap map);
 bool intmap_iter_next(IntMapIter iter, KeyValuePair* out);
@@ -11,6 +11,7 @@ typedef struct _charstack* CharStack;
 typedef struct _charqueue* CharQueue;
 
 CharQueue charqueue_new(void);
+CharQueue charqueue_new_bounded(size_t capacity);
 bool charqueue_is_empty(const CharQueue queue);
 void charqueue_clear(CharQueue queue);
 
@@ -19,6 +20,11 @@ bool charqueue_dequeue(CharQueue queue, char* out);
 bool charqueue_peek(const CharQueue queue, char* out);
 
 size_t charqueue_size(const CharQueue queue);
+size_t charqueue_capacity(const CharQueue queue);
+bool charqueue_is_full(const CharQueue queue);
+
+size_t charqueue_count(const CharQueue queue, char target);
+bool charqueue_contains(const CharQueue queue, char target);
 
 CharList charqueue_to_list(const CharQueue queue);
 CharStack charqueue_to_stack(const CharQueue queue);
@@ -0,0 +1,25 @@
+#ifndef INTBLOCKINGQUEUE_H
+
+#define INTBLOCKINGQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intblockingqueue* IntBlockingQueue;
+
+IntBlockingQueue intblockingqueue_new(void);
+IntBlockingQueue intblockingqueue_new_bounded(size_t capacity);
+bool intblockingqueue_is_empty(const IntBlockingQueue queue);
+void intblockingqueue_close(IntBlockingQueue queue);
+bool intblockingqueue_is_closed(const IntBlockingQueue queue);
+
+bool intblockingqueue_enqueue(IntBlockingQueue queue, int value);
+bool intblockingqueue_enqueue_timed(IntBlockingQueue queue, int value, long timeout_ms);
+bool intblockingqueue_dequeue(IntBlockingQueue queue, int* out);
+bool intblockingqueue_dequeue_timed(IntBlockingQueue queue, int* out, long timeout_ms);
+size_t intblockingqueue_dequeue_batch(IntBlockingQueue queue, int* buf, size_t max, long timeout_ms);
+
+size_t intblockingqueue_size(const IntBlockingQueue queue);
+size_t intblockingqueue_capacity(const IntBlockingQueue queue);
+
+#endif // INTBLOCKINGQUEUE_H
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef INTDEQUE_H
+
+#define INTDEQUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intstack* IntStack;
+typedef struct _intqueue* IntQueue;
+
+typedef struct _intdeque* IntDeque;
+
+IntDeque intdeque_new(void);
+IntDeque intdeque_from_array(const int* arr, size_t size);
+bool intdeque_is_empty(const IntDeque deque);
+void intdeque_clear(IntDeque deque);
+
+bool intdeque_push_back(IntDeque deque, int value);
+bool intdeque_push_front(IntDeque deque, int value);
+bool intdeque_push_back_n(IntDeque deque, const int* arr, size_t size);
+bool intdeque_pop_back(IntDeque deque, int* out);
+bool intdeque_pop_front(IntDeque deque, int* out);
+
+bool intdeque_front(const IntDeque deque, int* out);
+bool intdeque_back(const IntDeque deque, int* out);
+bool intdeque_get_at(const IntDeque deque, size_t index, int* out);
+bool intdeque_set_at(IntDeque deque, size_t index, int value);
+
+size_t intdeque_size(const IntDeque deque);
+
+int* intdeque_to_array(const IntDeque deque);
+IntList intdeque_to_list(const IntDeque deque);
+IntStack intdeque_to_stack(const IntDeque deque);
+IntQueue intdeque_to_queue(const IntDeque deque);
+
+#endif // INTDEQUE_H
\ No newline at end of file
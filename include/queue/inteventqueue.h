@@ -0,0 +1,23 @@
+#ifndef INTEVENTQUEUE_H
+
+#define INTEVENTQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _inteventqueue* IntEventQueue;
+
+IntEventQueue inteventqueue_new(void);
+IntEventQueue inteventqueue_new_bounded(size_t capacity);
+bool inteventqueue_is_empty(const IntEventQueue queue);
+int inteventqueue_fd(const IntEventQueue queue);
+
+bool inteventqueue_enqueue(IntEventQueue queue, int value);
+bool inteventqueue_enqueue_n(IntEventQueue queue, const int* arr, size_t size);
+bool inteventqueue_dequeue(IntEventQueue queue, int* out);
+size_t inteventqueue_dequeue_n(IntEventQueue queue, int* out, size_t size);
+
+size_t inteventqueue_size(const IntEventQueue queue);
+size_t inteventqueue_capacity(const IntEventQueue queue);
+
+#endif // INTEVENTQUEUE_H
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef INTMPMCQUEUE_H
+
+#define INTMPMCQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intmpmcqueue* IntMpmcQueue;
+
+IntMpmcQueue intmpmcqueue_new(size_t capacity);
+bool intmpmcqueue_is_empty(const IntMpmcQueue queue);
+
+bool intmpmcqueue_enqueue(IntMpmcQueue queue, int value);
+bool intmpmcqueue_enqueue_wait(IntMpmcQueue queue, int value);
+size_t intmpmcqueue_enqueue_n(IntMpmcQueue queue, const int* arr, size_t size);
+bool intmpmcqueue_dequeue(IntMpmcQueue queue, int* out);
+bool intmpmcqueue_dequeue_wait(IntMpmcQueue queue, int* out);
+size_t intmpmcqueue_dequeue_n(IntMpmcQueue queue, int* out, size_t size);
+
+size_t intmpmcqueue_size(const IntMpmcQueue queue);
+size_t intmpmcqueue_capacity(const IntMpmcQueue queue);
+bool intmpmcqueue_is_full(const IntMpmcQueue queue);
+
+#endif // INTMPMCQUEUE_H
\ No newline at end of file
@@ -7,20 +7,29 @@
 
 typedef struct _intlist* IntList;
 typedef struct _intstack* IntStack;
+typedef struct _intdeque* IntDeque;
 
 typedef struct _intqueue* IntQueue;
 
 IntQueue intqueue_new(void);
+IntQueue intqueue_new_bounded(size_t capacity);
 bool intqueue_is_empty(const IntQueue queue);
 void intqueue_clear(IntQueue queue);
 
 bool intqueue_enqueue(IntQueue queue, int value);
+bool intqueue_enqueue_n(IntQueue queue, const int* arr, size_t size);
 bool intqueue_dequeue(IntQueue queue, int* out);
+size_t intqueue_dequeue_n(IntQueue queue, int* out, size_t size);
 bool intqueue_peek(const IntQueue queue, int* out);
 
 size_t intqueue_size(const IntQueue queue);
+size_t intqueue_capacity(const IntQueue queue);
+bool intqueue_is_full(const IntQueue queue);
 
 IntList intqueue_to_list(const IntQueue queue);
 IntStack intqueue_to_stack(const IntQueue queue);
+IntDeque intqueue_to_deque(const IntQueue queue);
+IntList intqueue_into_list(IntQueue queue);
+IntStack intqueue_into_stack(IntQueue queue);
 
 #endif // INTQUEUE_H
\ No newline at end of file
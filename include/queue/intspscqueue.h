@@ -0,0 +1,23 @@
+#ifndef INTSPSCQUEUE_H
+
+#define INTSPSCQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intspscqueue* IntSpscQueue;
+
+IntSpscQueue intspscqueue_new(size_t capacity);
+bool intspscqueue_is_empty(const IntSpscQueue queue);
+
+bool intspscqueue_enqueue(IntSpscQueue queue, int value);
+size_t intspscqueue_enqueue_n(IntSpscQueue queue, const int* arr, size_t size);
+bool intspscqueue_dequeue(IntSpscQueue queue, int* out);
+size_t intspscqueue_dequeue_n(IntSpscQueue queue, int* out, size_t size);
+bool intspscqueue_peek(const IntSpscQueue queue, int* out);
+
+size_t intspscqueue_size(const IntSpscQueue queue);
+size_t intspscqueue_capacity(const IntSpscQueue queue);
+bool intspscqueue_is_full(const IntSpscQueue queue);
+
+#endif // INTSPSCQUEUE_H
\ No newline at end of file
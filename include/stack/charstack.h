@@ -12,12 +12,17 @@ typedef struct _charstack* CharStack;
 CharStack charstack_new(void);
 bool charstack_is_empty(const CharStack stack);
 void charstack_clear(CharStack stack);
+bool charstack_reserve(CharStack stack, size_t capacity);
 
 bool charstack_push(CharStack stack, char value);
 bool charstack_pop(CharStack stack, char* out);
 bool charstack_peek(const CharStack stack, char* out);
 
 size_t charstack_size(const CharStack stack);
+size_t charstack_capacity(const CharStack stack);
+
+size_t charstack_count(const CharStack stack, char target);
+bool charstack_contains(const CharStack stack, char target);
 
 CharList charstack_to_list(const CharStack stack);
 CharQueue charstack_to_queue(const CharStack stack);
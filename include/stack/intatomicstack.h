@@ -0,0 +1,16 @@
+#ifndef INTATOMICSTACK_H
+#define INTATOMICSTACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intatomicstack* IntAtomicStack;
+
+IntAtomicStack intatomicstack_new(void);
+bool intatomicstack_is_empty(const IntAtomicStack stack);
+
+bool intatomicstack_push(IntAtomicStack stack, int value);
+bool intatomicstack_push_n(IntAtomicStack stack, const int* arr, size_t size);
+bool intatomicstack_pop(IntAtomicStack stack, int* out);
+
+#endif // INTATOMICSTACK_H
\ No newline at end of file
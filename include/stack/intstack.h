@@ -6,20 +6,27 @@
 
 typedef struct _intlist* IntList;
 typedef struct _intqueue* IntQueue;
+typedef struct _intdeque* IntDeque;
 
 typedef struct _intstack* IntStack;
 
 IntStack intstack_new(void);
 bool intstack_is_empty(const IntStack stack);
 void intstack_clear(IntStack stack);
+bool intstack_reserve(IntStack stack, size_t capacity);
 
 bool intstack_push(IntStack stack, int value);
+bool intstack_push_n(IntStack stack, const int* arr, size_t size);
 bool intstack_pop(IntStack stack, int* out);
 bool intstack_peek(const IntStack stack, int* out);
 
 size_t intstack_size(IntStack stack);
+size_t intstack_capacity(const IntStack stack);
 
 IntList intstack_to_list(const IntStack stack);
 IntQueue intstack_to_queue(const IntStack stack);
+IntDeque intstack_to_deque(const IntStack stack);
+IntList intstack_into_list(IntStack stack);
+IntQueue intstack_into_queue(IntStack stack);
 
 #endif // INTSTACK_H
\ No newline at end of file
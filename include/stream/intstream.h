@@ -0,0 +1,29 @@
+#ifndef INTSTREAM_H
+#define INTSTREAM_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _intlist* IntList;
+typedef struct _intvec* IntVec;
+typedef struct _intqueue* IntQueue;
+
+typedef struct _intstream* IntStream;
+
+IntStream intstream_from_list(const IntList list);
+IntStream intstream_from_vec(const IntVec vec);
+IntStream intstream_from_queue(const IntQueue queue);
+IntStream intstream_from_array(const int* arr, size_t size);
+
+IntStream intstream_map(IntStream stream, int (*callback_func)(int value));
+IntStream intstream_filter(IntStream stream, bool (*predicate_func)(int value));
+IntStream intstream_take(IntStream stream, size_t count);
+IntStream intstream_skip(IntStream stream, size_t count);
+
+IntList intstream_collect(const IntStream stream);
+IntVec intstream_collect_vec(const IntStream stream);
+long long intstream_reduce(const IntStream stream, long long (*reduce_func)(long long acc, int value), long long initial);
+long long intstream_sum(const IntStream stream);
+size_t intstream_count(const IntStream stream);
+
+#endif // INTSTREAM_H
@@ -1,9 +1,13 @@
 #include "linkedlist/charlist.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
 #include "stack/charstack.h"
 #include "queue/charqueue.h"
 #include "internal/memmngr.h"
+#include "internal/nodepool.h"
+#include "internal/textio.h"
 
 typedef struct _charnode {
     char value;
@@ -15,6 +19,7 @@ struct _charlist {
     CharNode head;
     CharNode tail;
     size_t size;
+    NodePool pool;
 };
 
 static bool _charlist_not_exists(const CharList list) {
@@ -25,8 +30,8 @@ bool charlist_is_empty(const CharList list) {
     return _charlist_not_exists(list) || !list->head;
 }
 
-static CharNode _charlist_create_node(char value, CharNode prev, CharNode next) {
-    CharNode new_node = (CharNode) malloc(sizeof (struct _charnode));
+static CharNode _charlist_create_node(CharList list, char value, CharNode prev, CharNode next) {
+    CharNode new_node = (CharNode) _nodepool_alloc(list->pool);
     if (!new_node) return NULL;
 
     *new_node = (struct _charnode) {.value = value, .prev = prev, .next = next};
@@ -35,6 +40,7 @@ static CharNode _charlist_create_node(char value, CharNode prev, CharNode next)
 
 static void _charlist_free(CharList list) {
     charlist_clear(list);
+    _nodepool_destroy(list->pool);
     free(list);
 }
 
@@ -54,7 +60,7 @@ static CharNode _charlist_node_at(const CharList list, size_t index) {
 static bool _charlist_link_before(CharList list, char value, CharNode succ) {
     CharNode pred = succ ? succ->prev : list->tail;
 
-    CharNode new_node = _charlist_create_node(value, pred, succ);
+    CharNode new_node = _charlist_create_node(list, value, pred, succ);
     if (!new_node) return false;
 
     if (!pred)  list->head = new_node;
@@ -77,20 +83,66 @@ static void _charlist_unlink_node(CharList list, CharNode node) {
     if (!succ)  list->tail = pred;
     else        succ->prev = pred;
 
-    free(node);
+    _nodepool_free(node);
     list->size--;
 }
 
+// Links size nodes after the tail from a single pool request and returns the first one; without values they are zeroed
+static CharNode _charlist_append_nodes(CharList list, const char* values, size_t size) {
+    if (size == 0 || !_nodepool_reserve(list->pool, size)) return NULL;
+
+    CharNode first = NULL, pred = list->tail;
+    for (size_t i = 0; i < size; i++) {
+        CharNode node = (CharNode) _nodepool_alloc(list->pool);
+        *node = (struct _charnode) {.value = values ? values[i] : '\0', .prev = pred, .next = NULL};
+
+        if (!pred)  list->head = node;
+        else        pred->next = node;
+        if (!first) first = node;
+        pred = node;
+    }
+
+    list->tail = pred;
+    list->size += size;
+    return first;
+}
+
+// Links the run first..last before succ (after the tail when succ is NULL) without allocating or copying
+static void _charlist_link_run(CharList list, CharNode first, CharNode last, size_t size, CharNode succ) {
+    CharNode pred = succ ? succ->prev : list->tail;
+    first->prev = pred;
+    last->next = succ;
+
+    if (!pred)  list->head = first;
+    else        pred->next = first;
+
+    if (!succ)  list->tail = last;
+    else        succ->prev = last;
+
+    list->size += size;
+}
+
+static bool _charlist_append_chars(CharList list, const char* str, size_t size) {
+    return size == 0 || _charlist_append_nodes(list, str, size);
+}
+
 CharList charlist_new(void) {
     CharList new_list = (CharList) malloc(sizeof (struct _charlist));
     if (_charlist_not_exists(new_list)) return NULL;
 
+    NodePool pool = _nodepool_new(sizeof (struct _charnode));
+    if (!pool) {
+        free(new_list);
+        return NULL;
+    }
+
     if (!_memmngr_register(new_list, (void (*)(void*)) _charlist_free)) {
+        _nodepool_destroy(pool);
         free(new_list);
         return NULL;
     }
     
-    *new_list = (struct _charlist) {.head = NULL, .tail = NULL, .size = 0};
+    *new_list = (struct _charlist) {.head = NULL, .tail = NULL, .size = 0, .pool = pool};
     return new_list;
 }
 
@@ -99,7 +151,7 @@ void charlist_clear(CharList list) {
     
     for (CharNode curr = list->head, next; curr; curr = next) {
         next = curr->next;
-        free(curr);
+        _nodepool_free(curr);
     }
 
     list->head = list->tail = NULL;
@@ -114,6 +166,44 @@ bool charlist_push(CharList list, char value) {
     return !_charlist_not_exists(list) && _charlist_link_before(list, value, NULL);
 }
 
+bool charlist_append_str(CharList list, const char* str) {
+    return !_charlist_not_exists(list) && str && _charlist_append_chars(list, str, strlen(str));
+}
+
+bool charlist_concat(CharList dst, CharList src) {
+    return !_charlist_not_exists(dst) && charlist_splice(dst, dst->size, src);
+}
+
+bool charlist_splice(CharList dst, size_t pos, CharList src) {
+    if (_charlist_not_exists(dst) || _charlist_not_exists(src) || dst == src || pos > dst->size) return false;
+    if (src->size == 0) return true;
+
+    _charlist_link_run(dst, src->head, src->tail, src->size, pos < dst->size ? _charlist_node_at(dst, pos) : NULL);
+
+    src->head = src->tail = NULL;
+    src->size = 0;
+    return true;
+}
+
+CharList charlist_split_at(CharList list, size_t index) {
+    if (_charlist_not_exists(list) || index > list->size) return NULL;
+
+    CharList rest = charlist_new();
+    if (_charlist_not_exists(rest) || index == list->size) return rest;
+
+    CharNode first = _charlist_node_at(list, index);
+    CharNode last = list->tail;
+    size_t size = list->size - index;
+
+    list->tail = first->prev;
+    if (!list->tail)    list->head = NULL;
+    else                list->tail->next = NULL;
+    list->size = index;
+
+    _charlist_link_run(rest, first, last, size, NULL);
+    return rest;
+}
+
 bool charlist_push_at(CharList list, char value, size_t index) {
     return !_charlist_not_exists(list) && index <= list->size && _charlist_link_before(list, value, index < list->size ? _charlist_node_at(list, index) : NULL);
 }
@@ -189,6 +279,80 @@ void charlist_reverse(CharList list) {
     list->tail = head;
 }
 
+// Merges two sorted runs linked through next only, taking from the first run on ties to stay stable
+static CharNode _charlist_merge(CharNode a, CharNode b, int (*compare_func)(char a, char b, void* ctx), void* ctx) {
+    struct _charnode head;
+    CharNode tail = &head;
+    while (a && b) {
+        if (compare_func(a->value, b->value, ctx) > 0) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
+
+// Bottom-up merge sort that relinks the existing nodes without allocating; equal elements keep their relative order.
+// Runs are merged as soon as two of the same length exist, so most merges work on nodes that are still in cache.
+static void _charlist_merge_sort(CharList list, int (*compare_func)(char a, char b, void* ctx), void* ctx) {
+    CharNode runs[sizeof (size_t) * 8] = {NULL};
+    size_t max_run = 0;
+
+    for (CharNode curr = list->head, next; curr; curr = next) {
+        next = curr->next;
+        curr->next = NULL;
+
+        // runs[i] holds 2^i nodes that all precede the carry, which mirrors incrementing a binary counter
+        CharNode carry = curr;
+        size_t i = 0;
+        for (; runs[i]; i++) {
+            carry = _charlist_merge(runs[i], carry, compare_func, ctx);
+            runs[i] = NULL;
+        }
+        runs[i] = carry;
+        if (i > max_run) max_run = i;
+    }
+
+    CharNode head = NULL;
+    for (size_t i = 0; i <= max_run; i++) {
+        if (runs[i]) head = _charlist_merge(runs[i], head, compare_func, ctx);
+    }
+
+    CharNode prev = NULL;
+    for (CharNode curr = head; curr; prev = curr, curr = curr->next) curr->prev = prev;
+
+    list->head = head;
+    list->tail = prev;
+}
+
+// Counting sort: a char has few enough values to tally them all and rewrite the nodes in order
+void charlist_sort(CharList list) {
+    if (_charlist_not_exists(list) || list->size < 2) return;
+
+    size_t counts[UCHAR_MAX + 1] = {0};
+    for (CharNode curr = list->head; curr; curr = curr->next) counts[(unsigned char) curr->value]++;
+
+    CharNode curr = list->head;
+    for (int value = CHAR_MIN; value <= CHAR_MAX; value++) {
+        for (size_t freq = counts[(unsigned char) value]; freq > 0; freq--, curr = curr->next) curr->value = (char) value;
+    }
+}
+
+void charlist_sort_by(CharList list, int (*compare_func)(char a, char b, void* ctx), void* ctx) {
+    if (_charlist_not_exists(list) || list->size < 2) return;
+    if (!compare_func) {
+        charlist_sort(list);
+        return;
+    }
+
+    _charlist_merge_sort(list, compare_func, ctx);
+}
+
 char* charlist_to_string(const CharList list) {
     if (charlist_is_empty(list)) return NULL;
 
@@ -243,12 +407,10 @@ CharList charlist_from_string(char* str, size_t size) {
 
     CharList new_list = charlist_new();
     if (_charlist_not_exists(new_list)) return NULL;
-    
-    for (size_t i = 0; i < size; i++) {
-        if (!charlist_push(new_list, str[i])) {
-            _memmngr_rollback();
-            return NULL;
-        }
+
+    if (!_charlist_append_chars(new_list, str, size)) {
+        _memmngr_rollback();
+        return NULL;
     }
     return new_list;
 }
@@ -263,14 +425,15 @@ CharList charlist_copy(const CharList list) {
     if (_charlist_not_exists(list)) return NULL;
 
     CharList copy = charlist_new();
-    if (_charlist_not_exists(copy)) return NULL;
+    if (_charlist_not_exists(copy) || list->size == 0) return copy;
 
-    for (CharNode curr = list->head; curr; curr = curr->next) {
-        if (!charlist_push(copy, curr->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
+    CharNode dst = _charlist_append_nodes(copy, NULL, list->size);
+    if (!dst) {
+        _memmngr_rollback();
+        return NULL;
     }
+
+    for (CharNode src = list->head; src; src = src->next, dst = dst->next) dst->value = src->value;
     return copy;
 }
 
@@ -279,15 +442,15 @@ CharList charlist_map(const CharList list, char (*callback_func)(char value)) {
     if (!callback_func) return charlist_copy(list);
 
     CharList new_list = charlist_new();
-    if (_charlist_not_exists(new_list)) return NULL;
+    if (_charlist_not_exists(new_list) || list->size == 0) return new_list;
 
-    
-    for (CharNode curr = list->head; curr; curr = curr->next) {
-        if (!charlist_push(new_list, callback_func(curr->value))) {
-            _memmngr_rollback();
-            return NULL;
-        }
+    CharNode dst = _charlist_append_nodes(new_list, NULL, list->size);
+    if (!dst) {
+        _memmngr_rollback();
+        return NULL;
     }
+
+    for (CharNode src = list->head; src; src = src->next, dst = dst->next) dst->value = callback_func(src->value);
     return new_list;
 }
 
@@ -313,13 +476,19 @@ CharList charlist_zip(const CharList list1, const CharList list2) {
     if (_charlist_not_exists(list1) || _charlist_not_exists(list2)) return NULL;
 
     CharList new_list = charlist_new();
-    if (_charlist_not_exists(new_list)) return NULL;
+    size_t pairs = list1->size < list2->size ? list1->size : list2->size;
+    if (_charlist_not_exists(new_list) || pairs == 0) return new_list;
+
+    CharNode dst = _charlist_append_nodes(new_list, NULL, 2 * pairs);
+    if (!dst) {
+        _memmngr_rollback();
+        return NULL;
+    }
 
     for (CharNode curr1 = list1->head, curr2 = list2->head; curr1 && curr2; curr1 = curr1->next, curr2 = curr2->next) {
-        if (!charlist_push(new_list, curr1->value) || !charlist_push(new_list, curr2->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
+        dst->value = curr1->value;
+        dst->next->value = curr2->value;
+        dst = dst->next->next;
     }
     return new_list;
 }
@@ -353,13 +522,14 @@ void charlist_print(const CharList list) {
         return;
     }
 
-    CharNode curr = list->head;
-    while (curr) {
-        printf("%c", curr->value);
+    TextWriter writer;
+    _textio_writer_init(&writer, stdout);
 
-        if (curr->next) printf(" -> ");
-        curr = curr->next;
+    for (CharNode curr = list->head; curr; curr = curr->next) {
+        _textio_write(&writer, &curr->value, 1);
+        if (curr->next) _textio_write(&writer, " -> ", 4);
     }
+    _textio_flush(&writer);
 }
 
 bool charlist_contains(const CharList list, char target) {
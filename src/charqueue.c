@@ -1,18 +1,23 @@
 #include "queue/charqueue.h"
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include "linkedlist/charlist.h"
 #include "stack/charstack.h"
 #include "internal/memmngr.h"
+#include "internal/simd.h"
 
-typedef struct _charnode {
-    char value;
-    struct _charnode* next;
-} *CharNode;
+#define INITIAL_CAPACITY 16
+#define GROWTH_FACTOR 2
+#define MAX_CAPACITY (SIZE_MAX / 2 + 1)
 
+// Values sit in a ring of power-of-two capacity starting at head, so wrapping is a mask; a non-zero limit caps the size
 struct _charqueue {
-    CharNode front;
-    CharNode rear;
+    char* data;
+    size_t capacity;
+    size_t head;
     size_t size;
+    size_t limit;
 };
 
 static bool _charqueue_not_exists(const CharQueue queue) {
@@ -20,20 +25,42 @@ static bool _charqueue_not_exists(const CharQueue queue) {
 }
 
 bool charqueue_is_empty(const CharQueue queue) {
-    return _charqueue_not_exists(queue) || !queue->front;
+    return _charqueue_not_exists(queue) || queue->size == 0;
 }
 
-static CharNode _charqueue_create_node(char value, CharNode next) {
-    CharNode new_node = (CharNode) malloc(sizeof (struct _charnode));
-    if (!new_node) return NULL;
+static void _charqueue_free(CharQueue queue) {
+    free(queue->data);
+    free(queue);
+}
 
-    *new_node = (struct _charnode) {.value = value, .next = next};
-    return new_node;
+static size_t _charqueue_slot(const CharQueue queue, size_t offset) {
+    return (queue->head + offset) & (queue->capacity - 1);
 }
 
-static void _charqueue_free(CharQueue queue) {
-    charqueue_clear(queue);
-    free(queue);
+// Length of the contiguous part of the ring holding the first size values, the rest having wrapped to the start
+static size_t _charqueue_first_run(const CharQueue queue) {
+    return queue->capacity - queue->head < queue->size ? queue->capacity - queue->head : queue->size;
+}
+
+static bool _charqueue_realloc(CharQueue queue, size_t new_capacity) {
+    char* new_data = (char*) realloc(queue->data, new_capacity);
+    if (!new_data) return false;
+
+    // The part that wrapped around to the start is moved right after the old end, which at least doubling leaves room for
+    size_t wrapped = queue->head + queue->size > queue->capacity ? queue->head + queue->size - queue->capacity : 0;
+    memcpy(new_data + queue->capacity, new_data, wrapped);
+
+    queue->data = new_data;
+    queue->capacity = new_capacity;
+    return true;
+}
+
+static bool _charqueue_grow(CharQueue queue) {
+    if (queue->limit && queue->size == queue->limit) return false;
+    if (queue->size < queue->capacity) return true;
+    if (queue->capacity == MAX_CAPACITY) return false;
+
+    return _charqueue_realloc(queue, queue->capacity ? queue->capacity * GROWTH_FACTOR : INITIAL_CAPACITY);
 }
 
 CharQueue charqueue_new(void) {
@@ -45,33 +72,38 @@ CharQueue charqueue_new(void) {
         return NULL;
     }
 
-    *new_queue = (struct _charqueue) {.front = NULL, .rear = NULL, .size = 0};
+    *new_queue = (struct _charqueue) {.data = NULL, .capacity = 0, .head = 0, .size = 0, .limit = 0};
     return new_queue;
 }
 
-void charqueue_clear(CharQueue queue) {
-    if (charqueue_is_empty(queue)) return;
+CharQueue charqueue_new_bounded(size_t capacity) {
+    if (capacity == 0 || capacity > MAX_CAPACITY) return NULL;
+
+    CharQueue new_queue = charqueue_new();
+    if (_charqueue_not_exists(new_queue)) return NULL;
+
+    size_t ring = INITIAL_CAPACITY;
+    while (ring < capacity) ring *= GROWTH_FACTOR;
 
-    for (CharNode curr = queue->front, next; curr; curr = next) {
-        next = curr->next;
-        free(curr);
+    if (!_charqueue_realloc(new_queue, ring)) {
+        _memmngr_rollback();
+        return NULL;
     }
-    
-    queue->front = queue->rear = NULL;
-    queue->size = 0;
+    new_queue->limit = capacity;
+    return new_queue;
 }
 
-bool charqueue_enqueue(CharQueue queue, char value) {
-    if (_charqueue_not_exists(queue)) return false;
+void charqueue_clear(CharQueue queue) {
+    if (_charqueue_not_exists(queue)) return;
 
-    CharNode new_node = _charqueue_create_node(value, NULL);
-    if (!new_node) return false;
+    queue->head = 0;
+    queue->size = 0;
+}
 
-    CharNode rear = queue->rear;
-    queue->rear = new_node;
-    if (!rear)  queue->front = new_node;
-    else        rear->next = new_node;
+bool charqueue_enqueue(CharQueue queue, char value) {
+    if (_charqueue_not_exists(queue) || !_charqueue_grow(queue)) return false;
 
+    queue->data[_charqueue_slot(queue, queue->size)] = value;
     queue->size++;
     return true;
 }
@@ -79,36 +111,52 @@ bool charqueue_enqueue(CharQueue queue, char value) {
 bool charqueue_dequeue(CharQueue queue, char* out) {
     if (charqueue_is_empty(queue)) return false;
 
-    CharNode front = queue->front;
-    if (out) *out = front->value;
-
-    queue->front = front->next;
-    if (!queue->front) queue->rear = NULL;
-    
-    free(front);
-
+    if (out) *out = queue->data[queue->head];
+    queue->head = _charqueue_slot(queue, 1);
     queue->size--;
     return true;
 }
 
 bool charqueue_peek(CharQueue queue, char* out) {
     if (charqueue_is_empty(queue) || !out) return false;
-    *out = queue->front->value;
+    *out = queue->data[queue->head];
     return true;
 }
 
+bool charqueue_is_full(const CharQueue queue) {
+    return !_charqueue_not_exists(queue) && queue->limit && queue->size == queue->limit;
+}
+
+size_t charqueue_capacity(const CharQueue queue) {
+    return _charqueue_not_exists(queue) ? 0 : queue->limit ? queue->limit : queue->capacity;
+}
+
 size_t charqueue_size(const CharQueue queue) {
     return _charqueue_not_exists(queue) ? 0 : queue->size;
 }
 
+size_t charqueue_count(const CharQueue queue, char target) {
+    if (_charqueue_not_exists(queue)) return 0;
+
+    size_t run = _charqueue_first_run(queue);
+    return _simd_count_byte(queue->data + queue->head, run, target) + _simd_count_byte(queue->data, queue->size - run, target);
+}
+
+bool charqueue_contains(const CharQueue queue, char target) {
+    if (_charqueue_not_exists(queue)) return false;
+
+    size_t run = _charqueue_first_run(queue);
+    return _simd_find_byte(queue->data + queue->head, run, target) < run || _simd_find_byte(queue->data, queue->size - run, target) < queue->size - run;
+}
+
 CharList charqueue_to_list(const CharQueue queue) {
     if (_charqueue_not_exists(queue)) return NULL;
 
     CharList new_list = charlist_new();
     if (!new_list) return NULL;
 
-    for (CharNode curr = queue->front; curr; curr = curr->next) {
-        if (!charlist_push(new_list, curr->value)) {
+    for (size_t i = 0; i < queue->size; i++) {
+        if (!charlist_push(new_list, queue->data[_charqueue_slot(queue, i)])) {
             _memmngr_rollback();
             return NULL;
         }
@@ -122,8 +170,8 @@ CharStack charqueue_to_stack(const CharQueue queue) {
     CharStack new_stack = charstack_new();
     if (!new_stack) return NULL;
 
-    for (CharNode curr = queue->front; curr; curr = curr->next) {
-        if (!charstack_push(new_stack, curr->value)) {
+    for (size_t i = 0; i < queue->size; i++) {
+        if (!charstack_push(new_stack, queue->data[_charqueue_slot(queue, i)])) {
             _memmngr_rollback();
             return NULL;
         }
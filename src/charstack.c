@@ -1,17 +1,20 @@
 #include "stack/charstack.h"
 #include <stdlib.h>
+#include <stdint.h>
 #include "linkedlist/charlist.h"
 #include "queue/charqueue.h"
 #include "internal/memmngr.h"
+#include "internal/simd.h"
 
-typedef struct _charnode {
-    char value;
-    struct _charnode* next;
-} *CharNode;
+#define INITIAL_CAPACITY 16
+#define GROWTH_FACTOR 2
+#define MAX_CAPACITY SIZE_MAX
 
+// The top of the stack is the last element of data
 struct _charstack {
-    CharNode top;
+    char* data;
     size_t size;
+    size_t capacity;
 };
 
 static bool _charstack_not_exists(const CharStack stack) {
@@ -19,20 +22,29 @@ static bool _charstack_not_exists(const CharStack stack) {
 }
 
 bool charstack_is_empty(const CharStack stack) {
-    return _charstack_not_exists(stack) || !stack->top;
+    return _charstack_not_exists(stack) || stack->size == 0;
 }
 
-static CharNode _charstack_create_node(int value) {
-    CharNode new_node = (CharNode) malloc(sizeof (struct _charnode));
-    if (!new_node) return NULL;
+static void _charstack_free(CharStack stack) {
+    free(stack->data);
+    free(stack);
+}
 
-    *new_node = (struct _charnode) {.value = value, .next = NULL};
-    return new_node;
+static bool _charstack_realloc(CharStack stack, size_t new_capacity) {
+    char* new_data = (char*) realloc(stack->data, new_capacity);
+    if (!new_data) return false;
+
+    stack->data = new_data;
+    stack->capacity = new_capacity;
+    return true;
 }
 
-static void _charstack_free(CharStack stack) {
-    charstack_clear(stack);
-    free(stack);
+static bool _charstack_grow(CharStack stack) {
+    if (stack->size < stack->capacity) return true;
+    if (stack->capacity == MAX_CAPACITY) return false;
+
+    size_t new_capacity = !stack->capacity ? INITIAL_CAPACITY : stack->capacity > MAX_CAPACITY / GROWTH_FACTOR ? MAX_CAPACITY : stack->capacity * GROWTH_FACTOR;
+    return _charstack_realloc(stack, new_capacity);
 }
 
 CharStack charstack_new(void) {
@@ -44,51 +56,43 @@ CharStack charstack_new(void) {
         return NULL;
     }
 
-    *new_stack = (struct _charstack) {.top = NULL, .size = 0};
+    *new_stack = (struct _charstack) {.data = NULL, .size = 0, .capacity = 0};
     return new_stack;
 }
 
+// The storage is kept, so refilling a cleared stack does not reallocate
 void charstack_clear(CharStack stack) {
-    if (charstack_is_empty(stack)) return;
-
-    for (CharNode curr = stack->top, next; curr; curr = next) {
-        next = curr->next;
-        free(curr);
-    }
-
-    stack->top = NULL;
+    if (_charstack_not_exists(stack)) return;
     stack->size = 0;
 }
 
-bool charstack_push(CharStack stack, char value) {
+bool charstack_reserve(CharStack stack, size_t capacity) {
     if (_charstack_not_exists(stack)) return false;
+    return capacity <= stack->capacity || _charstack_realloc(stack, capacity);
+}
 
-    CharNode new_node = _charstack_create_node(value);
-    if (!new_node) return false;
+size_t charstack_capacity(const CharStack stack) {
+    return _charstack_not_exists(stack) ? 0 : stack->capacity;
+}
 
-    new_node->next = stack->top;
-    stack->top = new_node;
+bool charstack_push(CharStack stack, char value) {
+    if (_charstack_not_exists(stack) || !_charstack_grow(stack)) return false;
 
-    stack->size++;
+    stack->data[stack->size++] = value;
     return true;
 }
 
 bool charstack_pop(CharStack stack, char* out) {
     if (charstack_is_empty(stack)) return false;
 
-    CharNode top = stack->top;
-    if (out) *out = top->value;
-
-    stack->top = top->next;
-    free(top);
-
     stack->size--;
+    if (out) *out = stack->data[stack->size];
     return true;
 }
 
 bool charstack_peek(const CharStack stack, char* out) {
     if (charstack_is_empty(stack) || !out) return false;
-    *out = stack->top->value;
+    *out = stack->data[stack->size - 1];
     return true;
 }
 
@@ -96,14 +100,26 @@ size_t charstack_size(const CharStack stack) {
     return _charstack_not_exists(stack) ? 0 : stack->size;
 }
 
+size_t charstack_count(const CharStack stack, char target) {
+    if (_charstack_not_exists(stack)) return 0;
+
+    return _simd_count_byte(stack->data, stack->size, target);
+}
+
+bool charstack_contains(const CharStack stack, char target) {
+    if (_charstack_not_exists(stack)) return false;
+
+    return _simd_find_byte(stack->data, stack->size, target) < stack->size;
+}
+
 CharList charstack_to_list(const CharStack stack) {
     if (_charstack_not_exists(stack)) return NULL;
 
     CharList new_list = charlist_new();
     if (!new_list) return NULL;
 
-    for (CharNode curr = stack->top; curr; curr = curr->next) {
-        if (!charlist_push(new_list, curr->value)) {
+    for (size_t i = stack->size; i > 0; i--) {
+        if (!charlist_push(new_list, stack->data[i - 1])) {
             _memmngr_rollback();
             return NULL;
         }
@@ -117,8 +133,8 @@ CharQueue charstack_to_queue(const CharStack stack) {
     CharQueue new_queue = charqueue_new();
     if (!new_queue) return NULL;
     
-    for (CharNode curr = stack->top; curr; curr = curr->next) {
-        if (!charqueue_enqueue(new_queue, curr->value)) {
+    for (size_t i = stack->size; i > 0; i--) {
+        if (!charqueue_enqueue(new_queue, stack->data[i - 1])) {
             _memmngr_rollback();
             return NULL;
         }
@@ -0,0 +1,234 @@
+#include "stack/intatomicstack.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include "internal/memmngr.h"
+
+#define CACHE_LINE 64
+#define NIL UINT32_MAX
+#define FIRST_CHUNK 64
+#define MAX_CHUNKS 26
+#define ELIMINATION_SLOTS 8
+#define ELIMINATION_SPINS 128
+
+#define SLOT_EMPTY 0
+#define SLOT_WAITING (1ull << 32)
+#define SLOT_TAKEN (2ull << 32)
+
+// Nodes are addressed by 32-bit index and live in chunks that are only released with the stack, so a node popped
+// under a concurrent reader is still valid memory. Heads pack a tag above the index, bumped on every swap, so a
+// reader that saw an index before it was popped and pushed back again fails its CAS instead of corrupting the chain
+typedef struct _intatomicnode {
+    int value;
+    _Atomic uint32_t next;
+} IntAtomicNode;
+
+// A push and a pop that meet in a slot cancel out without ever touching the shared top
+typedef struct _eliminationslot {
+    alignas(CACHE_LINE) _Atomic uint64_t state;
+} EliminationSlot;
+
+struct _intatomicstack {
+    alignas(CACHE_LINE) _Atomic uint64_t top;
+    alignas(CACHE_LINE) _Atomic uint64_t free;
+    _Atomic uint32_t allocated;
+    _Atomic(IntAtomicNode*) chunks[MAX_CHUNKS];
+    EliminationSlot elimination[ELIMINATION_SLOTS];
+};
+
+static bool _intatomicstack_not_exists(const IntAtomicStack stack) {
+    return !stack;
+}
+
+static void _intatomicstack_free(IntAtomicStack stack) {
+    for (size_t i = 0; i < MAX_CHUNKS; i++) free(atomic_load(&stack->chunks[i]));
+    free(stack);
+}
+
+IntAtomicStack intatomicstack_new(void) {
+    IntAtomicStack new_stack = (IntAtomicStack) aligned_alloc(CACHE_LINE, sizeof (struct _intatomicstack));
+    if (_intatomicstack_not_exists(new_stack)) return NULL;
+
+    if (!_memmngr_register(new_stack, (void (*)(void*)) _intatomicstack_free)) {
+        free(new_stack);
+        return NULL;
+    }
+
+    atomic_init(&new_stack->top, NIL);
+    atomic_init(&new_stack->free, NIL);
+    atomic_init(&new_stack->allocated, 0);
+    for (size_t i = 0; i < MAX_CHUNKS; i++) atomic_init(&new_stack->chunks[i], NULL);
+    for (size_t i = 0; i < ELIMINATION_SLOTS; i++) atomic_init(&new_stack->elimination[i].state, SLOT_EMPTY);
+    return new_stack;
+}
+
+static uint32_t _intatomicstack_index(uint64_t head) {
+    return (uint32_t) head;
+}
+
+static uint64_t _intatomicstack_head(uint64_t previous, uint32_t index) {
+    return ((previous >> 32) + 1) << 32 | index;
+}
+
+// Chunk k holds FIRST_CHUNK << k nodes, so chunk lookups are a leading-zero count instead of a table walk
+static size_t _intatomicstack_chunk(uint32_t index, size_t* offset) {
+    size_t k = 63 - __builtin_clzll((uint64_t) index / FIRST_CHUNK + 1);
+    *offset = index - FIRST_CHUNK * ((1ull << k) - 1);
+    return k;
+}
+
+static IntAtomicNode* _intatomicstack_node(const IntAtomicStack stack, uint32_t index) {
+    size_t offset;
+    size_t k = _intatomicstack_chunk(index, &offset);
+    return atomic_load_explicit(&stack->chunks[k], memory_order_acquire) + offset;
+}
+
+static void _intatomicstack_push_chain(_Atomic uint64_t* head, IntAtomicStack stack, uint32_t first, uint32_t last) {
+    IntAtomicNode* last_node = _intatomicstack_node(stack, last);
+    uint64_t curr = atomic_load_explicit(head, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&last_node->next, _intatomicstack_index(curr), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(head, &curr, _intatomicstack_head(curr, first), memory_order_release, memory_order_relaxed));
+}
+
+static uint32_t _intatomicstack_pop_node(_Atomic uint64_t* head, IntAtomicStack stack) {
+    uint64_t curr = atomic_load_explicit(head, memory_order_acquire);
+    while (_intatomicstack_index(curr) != NIL) {
+        uint32_t next = atomic_load_explicit(&_intatomicstack_node(stack, _intatomicstack_index(curr))->next, memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(head, &curr, _intatomicstack_head(curr, next), memory_order_acquire, memory_order_acquire)) break;
+    }
+    return _intatomicstack_index(curr);
+}
+
+// Recycled nodes come first; fresh ones are numbered by a counter and their chunk is installed by whoever gets there first
+static uint32_t _intatomicstack_alloc(IntAtomicStack stack) {
+    uint32_t index = _intatomicstack_pop_node(&stack->free, stack);
+    if (index != NIL) return index;
+
+    index = atomic_fetch_add_explicit(&stack->allocated, 1, memory_order_relaxed);
+    if (index == NIL) return NIL;
+
+    size_t offset;
+    size_t k = _intatomicstack_chunk(index, &offset);
+    if (k >= MAX_CHUNKS) return NIL;
+    if (atomic_load_explicit(&stack->chunks[k], memory_order_acquire)) return index;
+
+    IntAtomicNode* chunk = (IntAtomicNode*) malloc(sizeof (IntAtomicNode) * (FIRST_CHUNK << k));
+    if (!chunk) return NIL;
+
+    IntAtomicNode* expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&stack->chunks[k], &expected, chunk, memory_order_acq_rel, memory_order_acquire)) free(chunk);
+    return index;
+}
+
+static size_t _intatomicstack_random_slot(void) {
+    static _Thread_local uint32_t seed = 0;
+    if (seed == 0) seed = (uint32_t) (uintptr_t) &seed | 1;
+
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed % ELIMINATION_SLOTS;
+}
+
+// Offers the value in a free slot for a while; true if a pop took it, false if the push still has to go through top
+static bool _intatomicstack_eliminate_push(IntAtomicStack stack, int value) {
+    _Atomic uint64_t* state = &stack->elimination[_intatomicstack_random_slot()].state;
+
+    uint64_t empty = SLOT_EMPTY, offer = SLOT_WAITING | (uint32_t) value;
+    if (!atomic_compare_exchange_strong_explicit(state, &empty, offer, memory_order_relaxed, memory_order_relaxed)) return false;
+
+    for (int i = 0; i < ELIMINATION_SPINS; i++) {
+        if (atomic_load_explicit(state, memory_order_acquire) == SLOT_TAKEN) break;
+    }
+
+    // Only the offering push resets its slot, so failing to withdraw means a pop has taken the value
+    if (atomic_compare_exchange_strong_explicit(state, &offer, SLOT_EMPTY, memory_order_relaxed, memory_order_relaxed)) return false;
+    atomic_store_explicit(state, SLOT_EMPTY, memory_order_release);
+    return true;
+}
+
+static bool _intatomicstack_eliminate_pop(IntAtomicStack stack, int* out) {
+    _Atomic uint64_t* state = &stack->elimination[_intatomicstack_random_slot()].state;
+
+    uint64_t offer = atomic_load_explicit(state, memory_order_relaxed);
+    if ((offer & ~(uint64_t) UINT32_MAX) != SLOT_WAITING) return false;
+    if (!atomic_compare_exchange_strong_explicit(state, &offer, SLOT_TAKEN, memory_order_acq_rel, memory_order_relaxed)) return false;
+
+    if (out) *out = (int) (uint32_t) offer;
+    return true;
+}
+
+bool intatomicstack_push(IntAtomicStack stack, int value) {
+    if (_intatomicstack_not_exists(stack)) return false;
+
+    uint32_t index = _intatomicstack_alloc(stack);
+    if (index == NIL) return false;
+
+    IntAtomicNode* node = _intatomicstack_node(stack, index);
+    node->value = value;
+
+    // One attempt on top first; only under contention is the value offered to a concurrent pop
+    uint64_t curr = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    while (true) {
+        atomic_store_explicit(&node->next, _intatomicstack_index(curr), memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(&stack->top, &curr, _intatomicstack_head(curr, index), memory_order_release, memory_order_relaxed)) return true;
+
+        if (_intatomicstack_eliminate_push(stack, value)) {
+            _intatomicstack_push_chain(&stack->free, stack, index, index);
+            return true;
+        }
+        curr = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    }
+}
+
+// The values are linked into a private chain first, then published with a single swap of top
+bool intatomicstack_push_n(IntAtomicStack stack, const int* arr, size_t size) {
+    if (_intatomicstack_not_exists(stack) || (!arr && size > 0)) return false;
+    if (size == 0) return true;
+
+    uint32_t first = NIL, last = NIL;
+    for (size_t i = 0; i < size; i++) {
+        uint32_t index = _intatomicstack_alloc(stack);
+        if (index == NIL) {
+            if (first != NIL) _intatomicstack_push_chain(&stack->free, stack, first, last);
+            return false;
+        }
+
+        IntAtomicNode* node = _intatomicstack_node(stack, index);
+        node->value = arr[i];
+        atomic_store_explicit(&node->next, first, memory_order_relaxed);
+        if (last == NIL) last = index;
+        first = index;
+    }
+
+    _intatomicstack_push_chain(&stack->top, stack, first, last);
+    return true;
+}
+
+bool intatomicstack_pop(IntAtomicStack stack, int* out) {
+    if (_intatomicstack_not_exists(stack)) return false;
+
+    uint64_t curr = atomic_load_explicit(&stack->top, memory_order_acquire);
+    while (_intatomicstack_index(curr) != NIL) {
+        uint32_t index = _intatomicstack_index(curr);
+        IntAtomicNode* node = _intatomicstack_node(stack, index);
+        uint32_t next = atomic_load_explicit(&node->next, memory_order_relaxed);
+
+        if (atomic_compare_exchange_weak_explicit(&stack->top, &curr, _intatomicstack_head(curr, next), memory_order_acquire, memory_order_acquire)) {
+            if (out) *out = node->value;
+            _intatomicstack_push_chain(&stack->free, stack, index, index);
+            return true;
+        }
+
+        if (_intatomicstack_eliminate_pop(stack, out)) return true;
+        curr = atomic_load_explicit(&stack->top, memory_order_acquire);
+    }
+    return false;
+}
+
+// Under concurrent use this is only a snapshot of the moment top was read
+bool intatomicstack_is_empty(const IntAtomicStack stack) {
+    return _intatomicstack_not_exists(stack) || _intatomicstack_index(atomic_load_explicit(&stack->top, memory_order_acquire)) == NIL;
+}
\ No newline at end of file
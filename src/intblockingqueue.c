@@ -0,0 +1,197 @@
+#include "queue/intblockingqueue.h"
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+
+// An IntQueue behind one lock. Waiters are counted so that enqueues and dequeues only signal when they move the
+// queue off empty or off full and someone is actually waiting; a woken thread passes the signal on if more is left
+struct _intblockingqueue {
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    IntQueue queue;
+    size_t consumers_waiting;
+    size_t producers_waiting;
+    bool closed;
+};
+
+static bool _intblockingqueue_not_exists(const IntBlockingQueue queue) {
+    return !queue;
+}
+
+static void _intblockingqueue_free(IntBlockingQueue queue) {
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    free(queue);
+}
+
+// Takes ownership of the already registered queue, rolling it back as well if anything fails
+static IntBlockingQueue _intblockingqueue_wrap(IntQueue queue) {
+    if (!queue) return NULL;
+
+    IntBlockingQueue new_queue = (IntBlockingQueue) malloc(sizeof (struct _intblockingqueue));
+    if (_intblockingqueue_not_exists(new_queue)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    // Timed waits measure against the monotonic clock, so wall clock adjustments cannot stretch or cut them short
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&new_queue->lock, NULL);
+    pthread_cond_init(&new_queue->not_empty, &attr);
+    pthread_cond_init(&new_queue->not_full, &attr);
+    pthread_condattr_destroy(&attr);
+
+    if (!_memmngr_register(new_queue, (void (*)(void*)) _intblockingqueue_free)) {
+        _intblockingqueue_free(new_queue);
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    new_queue->queue = queue;
+    new_queue->consumers_waiting = 0;
+    new_queue->producers_waiting = 0;
+    new_queue->closed = false;
+    return new_queue;
+}
+
+IntBlockingQueue intblockingqueue_new(void) {
+    return _intblockingqueue_wrap(intqueue_new());
+}
+
+IntBlockingQueue intblockingqueue_new_bounded(size_t capacity) {
+    return _intblockingqueue_wrap(intqueue_new_bounded(capacity));
+}
+
+static bool _intblockingqueue_can_dequeue(const IntBlockingQueue queue) {
+    return queue->closed || !intqueue_is_empty(queue->queue);
+}
+
+static bool _intblockingqueue_can_enqueue(const IntBlockingQueue queue) {
+    return queue->closed || !intqueue_is_full(queue->queue);
+}
+
+// Called with the lock held. A negative timeout waits for as long as it takes, zero does not wait at all
+static bool _intblockingqueue_wait(IntBlockingQueue queue, pthread_cond_t* cond, size_t* waiting, bool (*ready)(const IntBlockingQueue), long timeout_ms) {
+    if (ready(queue) || timeout_ms == 0) return ready(queue);
+
+    struct timespec deadline;
+    if (timeout_ms > 0) {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += (timeout_ms % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+    }
+
+    (*waiting)++;
+    int status = 0;
+    while (!ready(queue) && status != ETIMEDOUT) {
+        status = timeout_ms < 0 ? pthread_cond_wait(cond, &queue->lock) : pthread_cond_timedwait(cond, &queue->lock, &deadline);
+    }
+    (*waiting)--;
+    return ready(queue);
+}
+
+// Called with the lock held after values were taken out
+static void _intblockingqueue_after_dequeue(IntBlockingQueue queue, bool was_full) {
+    if (was_full && queue->producers_waiting) pthread_cond_signal(&queue->not_full);
+    if (!intqueue_is_empty(queue->queue) && queue->consumers_waiting) pthread_cond_signal(&queue->not_empty);
+}
+
+bool intblockingqueue_enqueue_timed(IntBlockingQueue queue, int value, long timeout_ms) {
+    if (_intblockingqueue_not_exists(queue)) return false;
+
+    pthread_mutex_lock(&queue->lock);
+    bool enqueued = false;
+    if (_intblockingqueue_wait(queue, &queue->not_full, &queue->producers_waiting, _intblockingqueue_can_enqueue, timeout_ms) && !queue->closed) {
+        bool was_empty = intqueue_is_empty(queue->queue);
+        enqueued = intqueue_enqueue(queue->queue, value);
+
+        if (enqueued && was_empty && queue->consumers_waiting) pthread_cond_signal(&queue->not_empty);
+        if (!intqueue_is_full(queue->queue) && queue->producers_waiting) pthread_cond_signal(&queue->not_full);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return enqueued;
+}
+
+bool intblockingqueue_enqueue(IntBlockingQueue queue, int value) {
+    return intblockingqueue_enqueue_timed(queue, value, -1);
+}
+
+bool intblockingqueue_dequeue_timed(IntBlockingQueue queue, int* out, long timeout_ms) {
+    int value;
+    if (intblockingqueue_dequeue_batch(queue, &value, 1, timeout_ms) == 0) return false;
+
+    if (out) *out = value;
+    return true;
+}
+
+bool intblockingqueue_dequeue(IntBlockingQueue queue, int* out) {
+    return intblockingqueue_dequeue_timed(queue, out, -1);
+}
+
+// Waits like a single dequeue, then takes everything available up to max under that one wakeup
+size_t intblockingqueue_dequeue_batch(IntBlockingQueue queue, int* buf, size_t max, long timeout_ms) {
+    if (_intblockingqueue_not_exists(queue) || !buf || max == 0) return 0;
+
+    pthread_mutex_lock(&queue->lock);
+    size_t taken = 0;
+    if (_intblockingqueue_wait(queue, &queue->not_empty, &queue->consumers_waiting, _intblockingqueue_can_dequeue, timeout_ms)) {
+        bool was_full = intqueue_is_full(queue->queue);
+        taken = intqueue_dequeue_n(queue->queue, buf, max);
+        if (taken) _intblockingqueue_after_dequeue(queue, was_full);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return taken;
+}
+
+// Wakes every waiter; enqueues fail from now on, while dequeues keep draining what is left
+void intblockingqueue_close(IntBlockingQueue queue) {
+    if (_intblockingqueue_not_exists(queue)) return;
+
+    pthread_mutex_lock(&queue->lock);
+    queue->closed = true;
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_cond_broadcast(&queue->not_full);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+bool intblockingqueue_is_closed(const IntBlockingQueue queue) {
+    if (_intblockingqueue_not_exists(queue)) return true;
+
+    pthread_mutex_lock(&queue->lock);
+    bool closed = queue->closed;
+    pthread_mutex_unlock(&queue->lock);
+    return closed;
+}
+
+size_t intblockingqueue_size(const IntBlockingQueue queue) {
+    if (_intblockingqueue_not_exists(queue)) return 0;
+
+    pthread_mutex_lock(&queue->lock);
+    size_t size = intqueue_size(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return size;
+}
+
+bool intblockingqueue_is_empty(const IntBlockingQueue queue) {
+    return intblockingqueue_size(queue) == 0;
+}
+
+size_t intblockingqueue_capacity(const IntBlockingQueue queue) {
+    if (_intblockingqueue_not_exists(queue)) return 0;
+
+    pthread_mutex_lock(&queue->lock);
+    size_t capacity = intqueue_capacity(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return capacity;
+}
\ No newline at end of file
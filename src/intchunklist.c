@@ -0,0 +1,537 @@
+#include "linkedlist/intchunklist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+#include "internal/simd.h"
+#include "internal/fill.h"
+#include "internal/textio.h"
+
+#define CACHE_LINE_SIZE 64
+#define CHUNK_CAPACITY (CACHE_LINE_SIZE / sizeof (int))
+
+// Each node stores up to CHUNK_CAPACITY contiguous values, so traversals touch one node per cache line of payload
+typedef struct _intchunk {
+    int values[CHUNK_CAPACITY];
+    size_t count;
+    struct _intchunk* next;
+    struct _intchunk* prev;
+} *IntChunk;
+
+struct _intchunklist {
+    IntChunk head;
+    IntChunk tail;
+    size_t size;
+};
+
+static bool _intchunklist_not_exists(const IntChunkList list) {
+    return !list;
+}
+
+bool intchunklist_is_empty(const IntChunkList list) {
+    return _intchunklist_not_exists(list) || !list->head;
+}
+
+static IntChunk _intchunklist_create_chunk(IntChunk prev, IntChunk next) {
+    IntChunk new_chunk = (IntChunk) malloc(sizeof (struct _intchunk));
+    if (!new_chunk) return NULL;
+
+    new_chunk->count = 0;
+    new_chunk->prev = prev;
+    new_chunk->next = next;
+    return new_chunk;
+}
+
+static void _intchunklist_free(IntChunkList list) {
+    intchunklist_clear(list);
+    free(list);
+}
+
+static IntChunk _intchunklist_link_chunk_after(IntChunkList list, IntChunk pred) {
+    IntChunk succ = pred ? pred->next : list->head;
+
+    IntChunk new_chunk = _intchunklist_create_chunk(pred, succ);
+    if (!new_chunk) return NULL;
+
+    if (!pred)  list->head = new_chunk;
+    else        pred->next = new_chunk;
+
+    if (!succ)  list->tail = new_chunk;
+    else        succ->prev = new_chunk;
+
+    return new_chunk;
+}
+
+static void _intchunklist_unlink_chunk(IntChunkList list, IntChunk chunk) {
+    IntChunk pred = chunk->prev;
+    IntChunk succ = chunk->next;
+
+    if (!pred)  list->head = succ;
+    else        pred->next = succ;
+
+    if (!succ)  list->tail = pred;
+    else        succ->prev = pred;
+
+    free(chunk);
+}
+
+// Finds the chunk holding the element at index, storing the element's position inside that chunk into offset
+static IntChunk _intchunklist_chunk_at(const IntChunkList list, size_t index, size_t* offset) {
+    IntChunk chunk;
+    if (index < list->size / 2) {
+        chunk = list->head;
+        while (index >= chunk->count) {
+            index -= chunk->count;
+            chunk = chunk->next;
+        }
+    } else {
+        chunk = list->tail;
+        index = list->size - index - 1;
+        while (index >= chunk->count) {
+            index -= chunk->count;
+            chunk = chunk->prev;
+        }
+        index = chunk->count - index - 1;
+    }
+    *offset = index;
+    return chunk;
+}
+
+static bool _intchunklist_insert(IntChunkList list, IntChunk chunk, size_t offset, int value) {
+    if (chunk->count == CHUNK_CAPACITY) {
+        // Split a full chunk in two halves, the upper one moving to a freshly linked chunk
+        IntChunk new_chunk = _intchunklist_link_chunk_after(list, chunk);
+        if (!new_chunk) return false;
+
+        size_t half = CHUNK_CAPACITY / 2;
+        memcpy(new_chunk->values, chunk->values + half, sizeof (int) * (CHUNK_CAPACITY - half));
+        new_chunk->count = CHUNK_CAPACITY - half;
+        chunk->count = half;
+
+        if (offset > half) {
+            chunk = new_chunk;
+            offset -= half;
+        }
+    }
+
+    memmove(chunk->values + offset + 1, chunk->values + offset, sizeof (int) * (chunk->count - offset));
+    chunk->values[offset] = value;
+    chunk->count++;
+    list->size++;
+    return true;
+}
+
+static void _intchunklist_remove(IntChunkList list, IntChunk chunk, size_t offset) {
+    memmove(chunk->values + offset, chunk->values + offset + 1, sizeof (int) * (chunk->count - offset - 1));
+    chunk->count--;
+    list->size--;
+
+    if (chunk->count == 0) {
+        _intchunklist_unlink_chunk(list, chunk);
+        return;
+    }
+
+    // Merge with the successor when both fit in one chunk, keeping nodes densely packed
+    IntChunk succ = chunk->next;
+    if (succ && chunk->count + succ->count <= CHUNK_CAPACITY) {
+        memcpy(chunk->values + chunk->count, succ->values, sizeof (int) * succ->count);
+        chunk->count += succ->count;
+        _intchunklist_unlink_chunk(list, succ);
+    }
+}
+
+IntChunkList intchunklist_new(void) {
+    IntChunkList new_list = (IntChunkList) malloc(sizeof (struct _intchunklist));
+    if (_intchunklist_not_exists(new_list)) return NULL;
+
+    if (!_memmngr_register(new_list, (void (*)(void*)) _intchunklist_free)) {
+        free(new_list);
+        return NULL;
+    }
+
+    *new_list = (struct _intchunklist) {.head = NULL, .tail = NULL, .size = 0};
+    return new_list;
+}
+
+void intchunklist_clear(IntChunkList list) {
+    if (_intchunklist_not_exists(list)) return;
+
+    for (IntChunk curr = list->head, next; curr; curr = next) {
+        next = curr->next;
+        free(curr);
+    }
+
+    list->head = list->tail = NULL;
+    list->size = 0;
+}
+
+bool intchunklist_push_front(IntChunkList list, int value) {
+    if (_intchunklist_not_exists(list)) return false;
+
+    IntChunk head = list->head;
+    if (!head || head->count == CHUNK_CAPACITY) {
+        head = _intchunklist_link_chunk_after(list, NULL);
+        if (!head) return false;
+    }
+    return _intchunklist_insert(list, head, 0, value);
+}
+
+bool intchunklist_push(IntChunkList list, int value) {
+    if (_intchunklist_not_exists(list)) return false;
+
+    IntChunk tail = list->tail;
+    if (!tail || tail->count == CHUNK_CAPACITY) {
+        tail = _intchunklist_link_chunk_after(list, tail);
+        if (!tail) return false;
+    }
+
+    tail->values[tail->count++] = value;
+    list->size++;
+    return true;
+}
+
+bool intchunklist_push_at(IntChunkList list, int value, size_t index) {
+    if (_intchunklist_not_exists(list) || index > list->size) return false;
+    if (index == list->size) return intchunklist_push(list, value);
+
+    size_t offset;
+    IntChunk chunk = _intchunklist_chunk_at(list, index, &offset);
+    return _intchunklist_insert(list, chunk, offset, value);
+}
+
+bool intchunklist_front(const IntChunkList list, int* out) {
+    if (intchunklist_is_empty(list) || !out) return false;
+    *out = list->head->values[0];
+    return true;
+}
+
+bool intchunklist_get_at(const IntChunkList list, size_t index, int* out) {
+    if (intchunklist_is_empty(list) || !out || index >= list->size) return false;
+
+    size_t offset;
+    *out = _intchunklist_chunk_at(list, index, &offset)->values[offset];
+    return true;
+}
+
+bool intchunklist_back(const IntChunkList list, int* out) {
+    if (intchunklist_is_empty(list) || !out) return false;
+    *out = list->tail->values[list->tail->count - 1];
+    return true;
+}
+
+int intchunklist_index(const IntChunkList list, int target) {
+    if (_intchunklist_not_exists(list)) return -1;
+
+    size_t base = 0;
+    for (IntChunk curr = list->head; curr; base += curr->count, curr = curr->next) {
+        size_t offset = _simd_find_int(curr->values, curr->count, target);
+        if (offset < curr->count) return base + offset;
+    }
+    return -1;
+}
+
+size_t intchunklist_count(const IntChunkList list, int target) {
+    if (_intchunklist_not_exists(list)) return 0;
+
+    size_t freq = 0;
+    for (IntChunk curr = list->head; curr; curr = curr->next) freq += _simd_count_int(curr->values, curr->count, target);
+    return freq;
+}
+
+void intchunklist_pop_front(IntChunkList list) {
+    if (intchunklist_is_empty(list)) return;
+    _intchunklist_remove(list, list->head, 0);
+}
+
+void intchunklist_pop(IntChunkList list) {
+    if (intchunklist_is_empty(list)) return;
+
+    IntChunk tail = list->tail;
+    list->size--;
+    if (--tail->count == 0) _intchunklist_unlink_chunk(list, tail);
+}
+
+void intchunklist_pop_at(IntChunkList list, size_t index) {
+    if (intchunklist_is_empty(list) || index >= list->size) return;
+
+    size_t offset;
+    IntChunk chunk = _intchunklist_chunk_at(list, index, &offset);
+    _intchunklist_remove(list, chunk, offset);
+}
+
+size_t intchunklist_size(const IntChunkList list) {
+    return _intchunklist_not_exists(list) ? 0 : list->size;
+}
+
+void intchunklist_reverse(IntChunkList list) {
+    if (_intchunklist_not_exists(list) || list->size < 2) return;
+
+    for (IntChunk curr = list->head, next; curr; curr = next) {
+        for (size_t i = 0, j = curr->count - 1; i < j; i++, j--) {
+            int tmp = curr->values[i];
+            curr->values[i] = curr->values[j];
+            curr->values[j] = tmp;
+        }
+
+        next = curr->next;
+        curr->next = curr->prev;
+        curr->prev = next;
+    }
+
+    IntChunk head = list->head;
+    list->head = list->tail;
+    list->tail = head;
+}
+
+int* intchunklist_to_array(const IntChunkList list) {
+    if (intchunklist_is_empty(list)) return NULL;
+
+    int* arr = (int*) malloc(sizeof (int) * list->size);
+    if (!arr) return NULL;
+
+    if (!_memmngr_register(arr, free)) {
+        free(arr);
+        return NULL;
+    }
+
+    size_t i = 0;
+    for (IntChunk curr = list->head; curr; i += curr->count, curr = curr->next) memcpy(arr + i, curr->values, sizeof (int) * curr->count);
+    return arr;
+}
+
+// Copies the values into arr front to back, one chunk at a time
+static void _intchunklist_copy_out(const IntChunkList list, int* arr) {
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        memcpy(arr, curr->values, sizeof (int) * curr->count);
+        arr += curr->count;
+    }
+}
+
+IntList intchunklist_to_list(const IntChunkList list) {
+    if (_intchunklist_not_exists(list)) return NULL;
+
+    IntList new_list = intlist_new();
+    if (!new_list) return NULL;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        if (!intlist_push_n(new_list, curr->values, curr->count)) {
+            _memmngr_rollback();
+            return NULL;
+        }
+    }
+    return new_list;
+}
+
+IntStack intchunklist_to_stack(const IntChunkList list) {
+    if (_intchunklist_not_exists(list)) return NULL;
+
+    IntStack new_stack = intstack_new();
+    if (!new_stack || intchunklist_is_empty(list)) return new_stack;
+
+    int* slots = _intstack_fill(new_stack, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intchunklist_copy_out(list, slots);
+    return new_stack;
+}
+
+IntQueue intchunklist_to_queue(const IntChunkList list) {
+    if (_intchunklist_not_exists(list)) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (!new_queue || intchunklist_is_empty(list)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intchunklist_copy_out(list, slots);
+    return new_queue;
+}
+
+IntChunkList intchunklist_from_array(int* arr, size_t size) {
+    if (!arr || size == 0) return NULL;
+
+    IntChunkList new_list = intchunklist_new();
+    if (_intchunklist_not_exists(new_list)) return NULL;
+
+    for (size_t i = 0; i < size; i++) {
+        if (!intchunklist_push(new_list, arr[i])) {
+            _memmngr_rollback();
+            return NULL;
+        }
+    }
+    return new_list;
+}
+
+void intchunklist_foreach(IntChunkList list, int (*callback_func)(int value)) {
+    if (_intchunklist_not_exists(list) || !callback_func) return;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) curr->values[i] = callback_func(curr->values[i]);
+    }
+}
+
+IntChunkList intchunklist_copy(const IntChunkList list) {
+    if (_intchunklist_not_exists(list)) return NULL;
+
+    IntChunkList copy = intchunklist_new();
+    if (_intchunklist_not_exists(copy)) return NULL;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        IntChunk new_chunk = _intchunklist_link_chunk_after(copy, copy->tail);
+        if (!new_chunk) {
+            _memmngr_rollback();
+            return NULL;
+        }
+
+        memcpy(new_chunk->values, curr->values, sizeof (int) * curr->count);
+        new_chunk->count = curr->count;
+    }
+    copy->size = list->size;
+    return copy;
+}
+
+IntChunkList intchunklist_map(const IntChunkList list, int (*callback_func)(int value)) {
+    if (_intchunklist_not_exists(list)) return NULL;
+    if (!callback_func) return intchunklist_copy(list);
+
+    IntChunkList new_list = intchunklist_new();
+    if (_intchunklist_not_exists(new_list)) return NULL;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) {
+            if (!intchunklist_push(new_list, callback_func(curr->values[i]))) {
+                _memmngr_rollback();
+                return NULL;
+            }
+        }
+    }
+    return new_list;
+}
+
+IntChunkList intchunklist_filter(const IntChunkList list, bool (*predicate_func)(int value)) {
+    if (_intchunklist_not_exists(list)) return NULL;
+    if (!predicate_func) return intchunklist_copy(list);
+
+    IntChunkList new_list = intchunklist_new();
+    if (_intchunklist_not_exists(new_list)) return NULL;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) {
+            if (predicate_func(curr->values[i])) {
+                if (!intchunklist_push(new_list, curr->values[i])) {
+                    _memmngr_rollback();
+                    return NULL;
+                }
+            }
+        }
+    }
+    return new_list;
+}
+
+IntChunkList intchunklist_zip(const IntChunkList list1, const IntChunkList list2) {
+    if (_intchunklist_not_exists(list1) || _intchunklist_not_exists(list2)) return NULL;
+
+    IntChunkList new_list = intchunklist_new();
+    if (_intchunklist_not_exists(new_list)) return NULL;
+
+    IntChunk curr1 = list1->head, curr2 = list2->head;
+    for (size_t i = 0, j = 0; curr1 && curr2; ) {
+        if (!intchunklist_push(new_list, curr1->values[i]) || !intchunklist_push(new_list, curr2->values[j])) {
+            _memmngr_rollback();
+            return NULL;
+        }
+
+        if (++i == curr1->count) curr1 = curr1->next, i = 0;
+        if (++j == curr2->count) curr2 = curr2->next, j = 0;
+    }
+    return new_list;
+}
+
+bool intchunklist_all(const IntChunkList list, bool (*predicate_func)(int value)) {
+    if (_intchunklist_not_exists(list)) return false;
+    if (!predicate_func) return true;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) if (!predicate_func(curr->values[i])) return false;
+    }
+    return true;
+}
+
+bool intchunklist_any(const IntChunkList list, bool (*predicate_func)(int value)) {
+    if (_intchunklist_not_exists(list) || !predicate_func) return false;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) if (predicate_func(curr->values[i])) return true;
+    }
+    return false;
+}
+
+long long intchunklist_reduce(const IntChunkList list, long long (*reduce_func)(long long acc, int value), long long initial) {
+    if (_intchunklist_not_exists(list) || !reduce_func) return initial;
+
+    long long acc = initial;
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) acc = reduce_func(acc, curr->values[i]);
+    }
+    return acc;
+}
+
+long long intchunklist_sum(const IntChunkList list) {
+    if (_intchunklist_not_exists(list)) return 0;
+
+    long long sum = 0;
+    for (IntChunk curr = list->head; curr; curr = curr->next) sum += _simd_sum_int(curr->values, curr->count);
+    return sum;
+}
+
+void intchunklist_print(const IntChunkList list) {
+    if (intchunklist_is_empty(list)) {
+        printf("NULL");
+        return;
+    }
+
+    TextWriter writer;
+    _textio_writer_init(&writer, stdout);
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) {
+            _textio_write_int(&writer, curr->values[i]);
+            if (curr->next || i + 1 < curr->count) _textio_write(&writer, " -> ", 4);
+        }
+    }
+    _textio_flush(&writer);
+}
+
+bool intchunklist_contains(const IntChunkList list, int target) {
+    if (_intchunklist_not_exists(list)) return false;
+
+    for (IntChunk curr = list->head; curr; curr = curr->next) {
+        if (_simd_find_int(curr->values, curr->count, target) < curr->count) return true;
+    }
+    return false;
+}
+
+bool intchunklist_equals(const IntChunkList list1, const IntChunkList list2) {
+    if (_intchunklist_not_exists(list1) || _intchunklist_not_exists(list2) || list1->size != list2->size) return false;
+
+    // Chunk boundaries may differ between equal lists, so each side keeps its own offset
+    IntChunk curr1 = list1->head, curr2 = list2->head;
+    for (size_t i = 0, j = 0; curr1 && curr2; ) {
+        size_t run = curr1->count - i < curr2->count - j ? curr1->count - i : curr2->count - j;
+        if (!_simd_equals_int(curr1->values + i, curr2->values + j, run)) return false;
+
+        if ((i += run) == curr1->count) curr1 = curr1->next, i = 0;
+        if ((j += run) == curr2->count) curr2 = curr2->next, j = 0;
+    }
+    return true;
+}
@@ -0,0 +1,489 @@
+#include "linkedlist/intcompactlist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+#include "internal/fill.h"
+#include "internal/textio.h"
+
+#define INITIAL_CAPACITY 16
+#define GROWTH_FACTOR 2
+#define NIL UINT32_MAX
+#define MAX_CAPACITY ((size_t) NIL)
+#define COPY_BATCH 256
+
+// Nodes live in one arena per list and link to each other by 32-bit slot index, so each one takes 12 bytes
+typedef struct _intcompactnode {
+    int value;
+    uint32_t next;
+    uint32_t prev;
+} IntCompactNode;
+
+// Slots below used have been handed out at least once; released ones are chained through next from free_slot
+struct _intcompactlist {
+    IntCompactNode* nodes;
+    size_t capacity;
+    size_t used;
+    uint32_t free_slot;
+    uint32_t head;
+    uint32_t tail;
+    size_t size;
+};
+
+static bool _intcompactlist_not_exists(const IntCompactList list) {
+    return !list;
+}
+
+bool intcompactlist_is_empty(const IntCompactList list) {
+    return _intcompactlist_not_exists(list) || list->head == NIL;
+}
+
+static void _intcompactlist_free(IntCompactList list) {
+    free(list->nodes);
+    free(list);
+}
+
+static bool _intcompactlist_realloc(IntCompactList list, size_t new_capacity) {
+    IntCompactNode* new_nodes = (IntCompactNode*) realloc(list->nodes, sizeof (IntCompactNode) * new_capacity);
+    if (!new_nodes) return false;
+
+    list->nodes = new_nodes;
+    list->capacity = new_capacity;
+    return true;
+}
+
+// Indices survive reallocation, so growing the arena never has to touch the links
+static uint32_t _intcompactlist_alloc_slot(IntCompactList list) {
+    if (list->free_slot != NIL) {
+        uint32_t slot = list->free_slot;
+        list->free_slot = list->nodes[slot].next;
+        return slot;
+    }
+
+    if (list->used == list->capacity) {
+        if (list->capacity == MAX_CAPACITY) return NIL;
+
+        size_t new_capacity = list->capacity ? list->capacity : INITIAL_CAPACITY;
+        new_capacity = new_capacity > MAX_CAPACITY / GROWTH_FACTOR ? MAX_CAPACITY : new_capacity * GROWTH_FACTOR;
+        if (!_intcompactlist_realloc(list, new_capacity)) return NIL;
+    }
+    return list->used++;
+}
+
+static uint32_t _intcompactlist_node_at(const IntCompactList list, size_t index) {
+    uint32_t node;
+    if (index < list->size / 2) {
+        node = list->head;
+        while (index--) node = list->nodes[node].next;
+    } else {
+        node = list->tail;
+        index = list->size - index - 1;
+        while (index--) node = list->nodes[node].prev;
+    }
+    return node;
+}
+
+static bool _intcompactlist_link_before(IntCompactList list, int value, uint32_t succ) {
+    uint32_t slot = _intcompactlist_alloc_slot(list);
+    if (slot == NIL) return false;
+
+    // Looked up after allocating, since the arena may have moved
+    IntCompactNode* nodes = list->nodes;
+    uint32_t pred = succ != NIL ? nodes[succ].prev : list->tail;
+    nodes[slot] = (IntCompactNode) {.value = value, .next = succ, .prev = pred};
+
+    if (pred == NIL)    list->head = slot;
+    else                nodes[pred].next = slot;
+
+    if (succ == NIL)    list->tail = slot;
+    else                nodes[succ].prev = slot;
+
+    list->size++;
+    return true;
+}
+
+static void _intcompactlist_unlink_node(IntCompactList list, uint32_t node) {
+    IntCompactNode* nodes = list->nodes;
+    uint32_t pred = nodes[node].prev;
+    uint32_t succ = nodes[node].next;
+
+    if (pred == NIL)    list->head = succ;
+    else                nodes[pred].next = succ;
+
+    if (succ == NIL)    list->tail = pred;
+    else                nodes[succ].prev = pred;
+
+    nodes[node].next = list->free_slot;
+    list->free_slot = node;
+    list->size--;
+}
+
+static void _intcompactlist_copy_out(const IntCompactList list, int* arr) {
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) *arr++ = list->nodes[curr].value;
+}
+
+IntCompactList intcompactlist_new(void) {
+    IntCompactList new_list = (IntCompactList) malloc(sizeof (struct _intcompactlist));
+    if (_intcompactlist_not_exists(new_list)) return NULL;
+
+    if (!_memmngr_register(new_list, (void (*)(void*)) _intcompactlist_free)) {
+        free(new_list);
+        return NULL;
+    }
+
+    *new_list = (struct _intcompactlist) {.nodes = NULL, .capacity = 0, .used = 0, .free_slot = NIL, .head = NIL, .tail = NIL, .size = 0};
+    return new_list;
+}
+
+IntCompactList intcompactlist_with_capacity(size_t capacity) {
+    IntCompactList new_list = intcompactlist_new();
+    if (_intcompactlist_not_exists(new_list)) return NULL;
+
+    if (!intcompactlist_reserve(new_list, capacity)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_list;
+}
+
+IntCompactList intcompactlist_from_array(int* arr, size_t size) {
+    if (!arr || size == 0) return NULL;
+
+    IntCompactList new_list = intcompactlist_with_capacity(size);
+    if (_intcompactlist_not_exists(new_list)) return NULL;
+
+    // Every slot is already reserved, so linking cannot fail
+    for (size_t i = 0; i < size; i++) _intcompactlist_link_before(new_list, arr[i], NIL);
+    return new_list;
+}
+
+// The arena is kept for reuse, like the storage of a cleared IntVec
+void intcompactlist_clear(IntCompactList list) {
+    if (_intcompactlist_not_exists(list)) return;
+
+    list->used = 0;
+    list->free_slot = list->head = list->tail = NIL;
+    list->size = 0;
+}
+
+bool intcompactlist_reserve(IntCompactList list, size_t capacity) {
+    if (_intcompactlist_not_exists(list) || capacity > MAX_CAPACITY) return false;
+    return capacity <= list->capacity || _intcompactlist_realloc(list, capacity);
+}
+
+// Rewrites the nodes in list order into an arena of exactly size slots, dropping released slots and restoring sequential locality
+bool intcompactlist_shrink_to_fit(IntCompactList list) {
+    if (_intcompactlist_not_exists(list)) return false;
+
+    if (list->size == 0) {
+        free(list->nodes);
+        list->nodes = NULL;
+        list->capacity = list->used = 0;
+        list->free_slot = NIL;
+        return true;
+    }
+
+    IntCompactNode* new_nodes = (IntCompactNode*) malloc(sizeof (IntCompactNode) * list->size);
+    if (!new_nodes) return false;
+
+    uint32_t i = 0;
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next, i++) {
+        new_nodes[i] = (IntCompactNode) {.value = list->nodes[curr].value, .next = i + 1, .prev = i - 1};
+    }
+    new_nodes[0].prev = new_nodes[list->size - 1].next = NIL;
+
+    free(list->nodes);
+    list->nodes = new_nodes;
+    list->capacity = list->used = list->size;
+    list->free_slot = NIL;
+    list->head = 0;
+    list->tail = list->size - 1;
+    return true;
+}
+
+size_t intcompactlist_capacity(const IntCompactList list) {
+    return _intcompactlist_not_exists(list) ? 0 : list->capacity;
+}
+
+bool intcompactlist_push_front(IntCompactList list, int value) {
+    return !_intcompactlist_not_exists(list) && _intcompactlist_link_before(list, value, list->head);
+}
+
+bool intcompactlist_push(IntCompactList list, int value) {
+    return !_intcompactlist_not_exists(list) && _intcompactlist_link_before(list, value, NIL);
+}
+
+bool intcompactlist_push_at(IntCompactList list, int value, size_t index) {
+    if (_intcompactlist_not_exists(list) || index > list->size) return false;
+    return _intcompactlist_link_before(list, value, index < list->size ? _intcompactlist_node_at(list, index) : NIL);
+}
+
+void intcompactlist_pop_front(IntCompactList list) {
+    if (intcompactlist_is_empty(list)) return;
+    _intcompactlist_unlink_node(list, list->head);
+}
+
+void intcompactlist_pop(IntCompactList list) {
+    if (intcompactlist_is_empty(list)) return;
+    _intcompactlist_unlink_node(list, list->tail);
+}
+
+void intcompactlist_pop_at(IntCompactList list, size_t index) {
+    if (intcompactlist_is_empty(list) || index >= list->size) return;
+    _intcompactlist_unlink_node(list, _intcompactlist_node_at(list, index));
+}
+
+size_t intcompactlist_size(const IntCompactList list) {
+    return _intcompactlist_not_exists(list) ? 0 : list->size;
+}
+
+bool intcompactlist_front(const IntCompactList list, int* out) {
+    if (intcompactlist_is_empty(list) || !out) return false;
+    *out = list->nodes[list->head].value;
+    return true;
+}
+
+bool intcompactlist_get_at(const IntCompactList list, size_t index, int* out) {
+    if (intcompactlist_is_empty(list) || !out || index >= list->size) return false;
+    *out = list->nodes[_intcompactlist_node_at(list, index)].value;
+    return true;
+}
+
+bool intcompactlist_set_at(IntCompactList list, size_t index, int value) {
+    if (intcompactlist_is_empty(list) || index >= list->size) return false;
+    list->nodes[_intcompactlist_node_at(list, index)].value = value;
+    return true;
+}
+
+bool intcompactlist_back(const IntCompactList list, int* out) {
+    if (intcompactlist_is_empty(list) || !out) return false;
+    *out = list->nodes[list->tail].value;
+    return true;
+}
+
+int intcompactlist_index(const IntCompactList list, int target) {
+    if (_intcompactlist_not_exists(list)) return -1;
+
+    int i = 0;
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next, i++) {
+        if (list->nodes[curr].value == target) return i;
+    }
+    return -1;
+}
+
+size_t intcompactlist_count(const IntCompactList list, int target) {
+    if (_intcompactlist_not_exists(list)) return 0;
+
+    size_t freq = 0;
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        if (list->nodes[curr].value == target) freq++;
+    }
+    return freq;
+}
+
+bool intcompactlist_contains(const IntCompactList list, int target) {
+    return intcompactlist_index(list, target) != -1;
+}
+
+bool intcompactlist_equals(const IntCompactList list1, const IntCompactList list2) {
+    if (_intcompactlist_not_exists(list1) || _intcompactlist_not_exists(list2) || list1->size != list2->size) return false;
+
+    for (uint32_t curr1 = list1->head, curr2 = list2->head; curr1 != NIL; curr1 = list1->nodes[curr1].next, curr2 = list2->nodes[curr2].next) {
+        if (list1->nodes[curr1].value != list2->nodes[curr2].value) return false;
+    }
+    return true;
+}
+
+IntCompactList intcompactlist_copy(const IntCompactList list) {
+    return intcompactlist_map(list, NULL);
+}
+
+// Copies are built in list order into a reserved arena, so they start out with sequential locality whatever the source layout
+IntCompactList intcompactlist_map(const IntCompactList list, int (*callback_func)(int value)) {
+    if (_intcompactlist_not_exists(list)) return NULL;
+
+    IntCompactList new_list = intcompactlist_with_capacity(list->size);
+    if (_intcompactlist_not_exists(new_list)) return NULL;
+
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        int value = list->nodes[curr].value;
+        _intcompactlist_link_before(new_list, callback_func ? callback_func(value) : value, NIL);
+    }
+    return new_list;
+}
+
+IntCompactList intcompactlist_filter(const IntCompactList list, bool (*predicate_func)(int value)) {
+    if (_intcompactlist_not_exists(list)) return NULL;
+    if (!predicate_func) return intcompactlist_copy(list);
+
+    IntCompactList new_list = intcompactlist_new();
+    if (_intcompactlist_not_exists(new_list)) return NULL;
+
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        if (predicate_func(list->nodes[curr].value) && !_intcompactlist_link_before(new_list, list->nodes[curr].value, NIL)) {
+            _memmngr_rollback();
+            return NULL;
+        }
+    }
+    return new_list;
+}
+
+IntCompactList intcompactlist_zip(const IntCompactList list1, const IntCompactList list2) {
+    if (_intcompactlist_not_exists(list1) || _intcompactlist_not_exists(list2)) return NULL;
+
+    size_t pairs = list1->size < list2->size ? list1->size : list2->size;
+    IntCompactList new_list = intcompactlist_with_capacity(2 * pairs);
+    if (_intcompactlist_not_exists(new_list)) return NULL;
+
+    uint32_t curr1 = list1->head, curr2 = list2->head;
+    for (size_t i = 0; i < pairs; i++, curr1 = list1->nodes[curr1].next, curr2 = list2->nodes[curr2].next) {
+        _intcompactlist_link_before(new_list, list1->nodes[curr1].value, NIL);
+        _intcompactlist_link_before(new_list, list2->nodes[curr2].value, NIL);
+    }
+    return new_list;
+}
+
+int* intcompactlist_to_array(const IntCompactList list) {
+    if (intcompactlist_is_empty(list)) return NULL;
+
+    int* arr = (int*) malloc(sizeof (int) * list->size);
+    if (!arr) return NULL;
+
+    _intcompactlist_copy_out(list, arr);
+    if (!_memmngr_register(arr, free)) {
+        free(arr);
+        return NULL;
+    }
+    return arr;
+}
+
+// Links follow slot indices rather than arena order, so values are gathered into a small on-stack batch and each batch
+// appended in one call
+IntList intcompactlist_to_list(const IntCompactList list) {
+    if (_intcompactlist_not_exists(list)) return NULL;
+
+    IntList new_list = intlist_new();
+    if (!new_list) return NULL;
+
+    int batch[COPY_BATCH];
+    size_t count = 0;
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        batch[count++] = list->nodes[curr].value;
+        if (count < COPY_BATCH && list->nodes[curr].next != NIL) continue;
+
+        if (!intlist_push_n(new_list, batch, count)) {
+            _memmngr_rollback();
+            return NULL;
+        }
+        count = 0;
+    }
+    return new_list;
+}
+
+IntStack intcompactlist_to_stack(const IntCompactList list) {
+    if (_intcompactlist_not_exists(list)) return NULL;
+
+    IntStack new_stack = intstack_new();
+    if (!new_stack || intcompactlist_is_empty(list)) return new_stack;
+
+    int* slots = _intstack_fill(new_stack, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intcompactlist_copy_out(list, slots);
+    return new_stack;
+}
+
+IntQueue intcompactlist_to_queue(const IntCompactList list) {
+    if (_intcompactlist_not_exists(list)) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (!new_queue || intcompactlist_is_empty(list)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intcompactlist_copy_out(list, slots);
+    return new_queue;
+}
+
+void intcompactlist_reverse(IntCompactList list) {
+    if (_intcompactlist_not_exists(list) || list->size < 2) return;
+
+    for (uint32_t curr = list->head, next; curr != NIL; curr = next) {
+        next = list->nodes[curr].next;
+        list->nodes[curr].next = list->nodes[curr].prev;
+        list->nodes[curr].prev = next;
+    }
+
+    uint32_t head = list->head;
+    list->head = list->tail;
+    list->tail = head;
+}
+
+void intcompactlist_foreach(IntCompactList list, int (*callback_func)(int value)) {
+    if (_intcompactlist_not_exists(list) || !callback_func) return;
+
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        list->nodes[curr].value = callback_func(list->nodes[curr].value);
+    }
+}
+
+long long intcompactlist_reduce(const IntCompactList list, long long (*reduce_func)(long long acc, int value), long long initial) {
+    if (_intcompactlist_not_exists(list) || !reduce_func) return initial;
+
+    long long acc = initial;
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) acc = reduce_func(acc, list->nodes[curr].value);
+    return acc;
+}
+
+bool intcompactlist_any(const IntCompactList list, bool (*predicate_func)(int value)) {
+    if (_intcompactlist_not_exists(list) || !predicate_func) return false;
+
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        if (predicate_func(list->nodes[curr].value)) return true;
+    }
+    return false;
+}
+
+bool intcompactlist_all(const IntCompactList list, bool (*predicate_func)(int value)) {
+    if (_intcompactlist_not_exists(list)) return false;
+    if (!predicate_func) return true;
+
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        if (!predicate_func(list->nodes[curr].value)) return false;
+    }
+    return true;
+}
+
+long long intcompactlist_sum(const IntCompactList list) {
+    if (_intcompactlist_not_exists(list)) return 0;
+
+    long long sum = 0;
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) sum += list->nodes[curr].value;
+    return sum;
+}
+
+void intcompactlist_print(const IntCompactList list) {
+    if (intcompactlist_is_empty(list)) {
+        printf("NULL");
+        return;
+    }
+
+    TextWriter writer;
+    _textio_writer_init(&writer, stdout);
+
+    for (uint32_t curr = list->head; curr != NIL; curr = list->nodes[curr].next) {
+        _textio_write_int(&writer, list->nodes[curr].value);
+        if (list->nodes[curr].next != NIL) _textio_write(&writer, " -> ", 4);
+    }
+    _textio_flush(&writer);
+}
@@ -0,0 +1,305 @@
+#include "queue/intdeque.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+#include "internal/fill.h"
+
+#define BLOCK_SHIFT 9
+#define BLOCK_SIZE ((size_t) 1 << BLOCK_SHIFT)
+#define BLOCK_MASK (BLOCK_SIZE - 1)
+#define INITIAL_MAP_SIZE 8
+#define GROWTH_FACTOR 2
+#define MAX_MAP_SIZE (SIZE_MAX / sizeof (int*) / BLOCK_SIZE)
+
+// Values live in fixed blocks listed in a map, addressed as one virtual array starting at start, so an index is a
+// shift and a mask. Only blocks covering [start, start + size) are allocated; a block emptied at one end is kept as
+// the spare and reused at the other, so a sliding window settles into two blocks and stops calling malloc
+struct _intdeque {
+    int** map;
+    size_t map_size;
+    size_t start;
+    size_t size;
+    int* spare;
+};
+
+static bool _intdeque_not_exists(const IntDeque deque) {
+    return !deque;
+}
+
+bool intdeque_is_empty(const IntDeque deque) {
+    return _intdeque_not_exists(deque) || deque->size == 0;
+}
+
+static void _intdeque_free(IntDeque deque) {
+    for (size_t i = 0; i < deque->map_size; i++) free(deque->map[i]);
+    free(deque->map);
+    free(deque->spare);
+    free(deque);
+}
+
+IntDeque intdeque_new(void) {
+    IntDeque new_deque = (IntDeque) malloc(sizeof (struct _intdeque));
+    if (_intdeque_not_exists(new_deque)) return NULL;
+
+    if (!_memmngr_register(new_deque, (void (*)(void*)) _intdeque_free)) {
+        free(new_deque);
+        return NULL;
+    }
+
+    *new_deque = (struct _intdeque) {.map = NULL, .map_size = 0, .start = 0, .size = 0, .spare = NULL};
+    return new_deque;
+}
+
+IntDeque intdeque_from_array(const int* arr, size_t size) {
+    if (!arr || size == 0) return NULL;
+
+    IntDeque new_deque = intdeque_new();
+    if (_intdeque_not_exists(new_deque)) return NULL;
+
+    if (!intdeque_push_back_n(new_deque, arr, size)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_deque;
+}
+
+static int* _intdeque_slot(const IntDeque deque, size_t index) {
+    size_t pos = deque->start + index;
+    return deque->map[pos >> BLOCK_SHIFT] + (pos & BLOCK_MASK);
+}
+
+static void _intdeque_release(IntDeque deque, size_t block) {
+    if (deque->spare) free(deque->map[block]);
+    else deque->spare = deque->map[block];
+    deque->map[block] = NULL;
+}
+
+static bool _intdeque_ensure_block(IntDeque deque, size_t block) {
+    if (deque->map[block]) return true;
+
+    int* new_block = deque->spare ? deque->spare : (int*) malloc(sizeof (int) * BLOCK_SIZE);
+    if (!new_block) return false;
+
+    deque->spare = NULL;
+    deque->map[block] = new_block;
+    return true;
+}
+
+// Re-centres the used blocks with at least one free map slot on each side. The map only grows when the blocks in
+// use would fill more than half of it, so moving back and forth at one end re-centres instead of growing forever
+static bool _intdeque_make_room(IntDeque deque) {
+    size_t first = deque->start >> BLOCK_SHIFT;
+    size_t used = deque->size ? ((deque->start + deque->size - 1) >> BLOCK_SHIFT) - first + 1 : 0;
+
+    size_t new_map_size = deque->map_size ? deque->map_size : INITIAL_MAP_SIZE;
+    while (new_map_size < 2 * (used + 1)) {
+        if (new_map_size > MAX_MAP_SIZE / GROWTH_FACTOR) return false;
+        new_map_size *= GROWTH_FACTOR;
+    }
+
+    int** new_map = deque->map;
+    if (new_map_size != deque->map_size) {
+        new_map = (int**) calloc(new_map_size, sizeof (int*));
+        if (!new_map) return false;
+    }
+
+    size_t new_first = (new_map_size - used) / 2;
+    if (used) memmove(new_map + new_first, deque->map + first, sizeof (int*) * used);
+    if (new_map == deque->map) {
+        for (size_t i = 0; i < new_map_size; i++) {
+            if (i < new_first || i >= new_first + used) new_map[i] = NULL;
+        }
+    } else {
+        free(deque->map);
+    }
+
+    deque->map = new_map;
+    deque->map_size = new_map_size;
+    deque->start = (new_first << BLOCK_SHIFT) + (deque->start & BLOCK_MASK);
+    return true;
+}
+
+void intdeque_clear(IntDeque deque) {
+    if (_intdeque_not_exists(deque)) return;
+
+    for (size_t i = 0; i < deque->map_size; i++) {
+        if (deque->map[i]) _intdeque_release(deque, i);
+    }
+    deque->start = (deque->map_size << BLOCK_SHIFT) / 2;
+    deque->size = 0;
+}
+
+bool intdeque_push_back(IntDeque deque, int value) {
+    if (_intdeque_not_exists(deque)) return false;
+    if (deque->start + deque->size == deque->map_size << BLOCK_SHIFT && !_intdeque_make_room(deque)) return false;
+    if (!_intdeque_ensure_block(deque, (deque->start + deque->size) >> BLOCK_SHIFT)) return false;
+
+    *_intdeque_slot(deque, deque->size) = value;
+    deque->size++;
+    return true;
+}
+
+bool intdeque_push_front(IntDeque deque, int value) {
+    if (_intdeque_not_exists(deque)) return false;
+    if (deque->start == 0 && !_intdeque_make_room(deque)) return false;
+    if (!_intdeque_ensure_block(deque, (deque->start - 1) >> BLOCK_SHIFT)) return false;
+
+    deque->start--;
+    deque->size++;
+    *_intdeque_slot(deque, 0) = value;
+    return true;
+}
+
+// Fills whole block runs with memcpy; on failure the values pushed so far stay in the deque
+bool intdeque_push_back_n(IntDeque deque, const int* arr, size_t size) {
+    if (_intdeque_not_exists(deque) || (!arr && size > 0)) return false;
+
+    while (size > 0) {
+        if (deque->start + deque->size == deque->map_size << BLOCK_SHIFT && !_intdeque_make_room(deque)) return false;
+
+        size_t pos = deque->start + deque->size;
+        if (!_intdeque_ensure_block(deque, pos >> BLOCK_SHIFT)) return false;
+
+        size_t run = BLOCK_SIZE - (pos & BLOCK_MASK);
+        if (run > size) run = size;
+        memcpy(_intdeque_slot(deque, deque->size), arr, sizeof (int) * run);
+
+        deque->size += run;
+        arr += run;
+        size -= run;
+    }
+    return true;
+}
+
+bool intdeque_pop_back(IntDeque deque, int* out) {
+    if (intdeque_is_empty(deque)) return false;
+
+    size_t pos = deque->start + deque->size - 1;
+    if (out) *out = *_intdeque_slot(deque, deque->size - 1);
+    deque->size--;
+
+    if (deque->size == 0 || (pos & BLOCK_MASK) == 0) _intdeque_release(deque, pos >> BLOCK_SHIFT);
+    return true;
+}
+
+bool intdeque_pop_front(IntDeque deque, int* out) {
+    if (intdeque_is_empty(deque)) return false;
+
+    size_t pos = deque->start;
+    if (out) *out = *_intdeque_slot(deque, 0);
+    deque->start++;
+    deque->size--;
+
+    if (deque->size == 0 || (deque->start & BLOCK_MASK) == 0) _intdeque_release(deque, pos >> BLOCK_SHIFT);
+    return true;
+}
+
+bool intdeque_front(const IntDeque deque, int* out) {
+    return intdeque_get_at(deque, 0, out);
+}
+
+bool intdeque_back(const IntDeque deque, int* out) {
+    return !intdeque_is_empty(deque) && intdeque_get_at(deque, deque->size - 1, out);
+}
+
+bool intdeque_get_at(const IntDeque deque, size_t index, int* out) {
+    if (_intdeque_not_exists(deque) || index >= deque->size || !out) return false;
+
+    *out = *_intdeque_slot(deque, index);
+    return true;
+}
+
+bool intdeque_set_at(IntDeque deque, size_t index, int value) {
+    if (_intdeque_not_exists(deque) || index >= deque->size) return false;
+
+    *_intdeque_slot(deque, index) = value;
+    return true;
+}
+
+size_t intdeque_size(const IntDeque deque) {
+    return _intdeque_not_exists(deque) ? 0 : deque->size;
+}
+
+// How many values from index on can be read before the end of its block
+static size_t _intdeque_run(const IntDeque deque, size_t index) {
+    size_t run = BLOCK_SIZE - ((deque->start + index) & BLOCK_MASK);
+    return run < deque->size - index ? run : deque->size - index;
+}
+
+// Copies the values front to back, one memcpy per block
+static void _intdeque_copy_out(const IntDeque deque, int* arr) {
+    for (size_t copied = 0, run; copied < deque->size; copied += run) {
+        run = _intdeque_run(deque, copied);
+        memcpy(arr + copied, _intdeque_slot(deque, copied), sizeof (int) * run);
+    }
+}
+
+int* intdeque_to_array(const IntDeque deque) {
+    if (intdeque_is_empty(deque)) return NULL;
+
+    int* arr = (int*) malloc(sizeof (int) * deque->size);
+    if (!arr) return NULL;
+
+    _intdeque_copy_out(deque, arr);
+    if (!_memmngr_register(arr, free)) {
+        free(arr);
+        return NULL;
+    }
+    return arr;
+}
+
+IntList intdeque_to_list(const IntDeque deque) {
+    if (_intdeque_not_exists(deque)) return NULL;
+
+    IntList new_list = intlist_new();
+    if (!new_list || intdeque_is_empty(deque)) return new_list;
+
+    size_t pushed = 0;
+    for (size_t run; pushed < deque->size; pushed += run) {
+        run = _intdeque_run(deque, pushed);
+        if (!intlist_push_n(new_list, _intdeque_slot(deque, pushed), run)) break;
+    }
+
+    if (pushed < deque->size) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_list;
+}
+
+// The back of the deque becomes the top of the stack
+IntStack intdeque_to_stack(const IntDeque deque) {
+    if (_intdeque_not_exists(deque)) return NULL;
+
+    IntStack new_stack = intstack_new();
+    if (!new_stack || intdeque_is_empty(deque)) return new_stack;
+
+    int* slots = _intstack_fill(new_stack, deque->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intdeque_copy_out(deque, slots);
+    return new_stack;
+}
+
+IntQueue intdeque_to_queue(const IntDeque deque) {
+    if (_intdeque_not_exists(deque)) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (!new_queue || intdeque_is_empty(deque)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, deque->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intdeque_copy_out(deque, slots);
+    return new_queue;
+}
\ No newline at end of file
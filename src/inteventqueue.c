@@ -0,0 +1,157 @@
+#include "queue/inteventqueue.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/eventfd.h>
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+
+// An IntQueue behind one lock plus an eventfd. Only the empty to non-empty transition writes to it, so a burst costs
+// a single wakeup, and it is read once at the start of each drain, the run of dequeues that ends with one finding the
+// queue empty. Both calls happen outside the lock
+struct _inteventqueue {
+    pthread_mutex_t lock;
+    IntQueue queue;
+    int fd;
+    atomic_bool draining;
+};
+
+static bool _inteventqueue_not_exists(const IntEventQueue queue) {
+    return !queue;
+}
+
+static void _inteventqueue_free(IntEventQueue queue) {
+    close(queue->fd);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue);
+}
+
+// Takes ownership of the already registered queue, rolling it back as well if anything fails
+static IntEventQueue _inteventqueue_wrap(IntQueue queue) {
+    if (!queue) return NULL;
+
+    IntEventQueue new_queue = (IntEventQueue) malloc(sizeof (struct _inteventqueue));
+    if (_inteventqueue_not_exists(new_queue)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    new_queue->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (new_queue->fd < 0) {
+        free(new_queue);
+        _memmngr_rollback();
+        return NULL;
+    }
+    pthread_mutex_init(&new_queue->lock, NULL);
+    atomic_init(&new_queue->draining, false);
+
+    if (!_memmngr_register(new_queue, (void (*)(void*)) _inteventqueue_free)) {
+        _inteventqueue_free(new_queue);
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    new_queue->queue = queue;
+    return new_queue;
+}
+
+IntEventQueue inteventqueue_new(void) {
+    return _inteventqueue_wrap(intqueue_new());
+}
+
+IntEventQueue inteventqueue_new_bounded(size_t capacity) {
+    return _inteventqueue_wrap(intqueue_new_bounded(capacity));
+}
+
+int inteventqueue_fd(const IntEventQueue queue) {
+    return _inteventqueue_not_exists(queue) ? -1 : queue->fd;
+}
+
+// The eventfd is non-blocking, so neither the write nor the read can block, and their results carry nothing to act on
+static void _inteventqueue_notify(IntEventQueue queue) {
+    uint64_t one = 1;
+    ssize_t written = write(queue->fd, &one, sizeof (one));
+    (void) written;
+}
+
+// Resetting before taking anything keeps every value enqueued after a write in the same drain as that write. A write
+// that lands after the reset only causes one spurious wakeup, whose drain resets it again
+static void _inteventqueue_begin_drain(IntEventQueue queue) {
+    if (atomic_exchange_explicit(&queue->draining, true, memory_order_relaxed)) return;
+
+    uint64_t count;
+    ssize_t got = read(queue->fd, &count, sizeof (count));
+    (void) got;
+}
+
+bool inteventqueue_enqueue(IntEventQueue queue, int value) {
+    if (_inteventqueue_not_exists(queue)) return false;
+
+    pthread_mutex_lock(&queue->lock);
+    bool was_empty = intqueue_is_empty(queue->queue);
+    bool enqueued = intqueue_enqueue(queue->queue, value);
+    pthread_mutex_unlock(&queue->lock);
+
+    if (enqueued && was_empty) _inteventqueue_notify(queue);
+    return enqueued;
+}
+
+bool inteventqueue_enqueue_n(IntEventQueue queue, const int* arr, size_t size) {
+    if (_inteventqueue_not_exists(queue)) return false;
+
+    pthread_mutex_lock(&queue->lock);
+    bool was_empty = intqueue_is_empty(queue->queue);
+    bool enqueued = intqueue_enqueue_n(queue->queue, arr, size);
+    pthread_mutex_unlock(&queue->lock);
+
+    if (enqueued && size > 0 && was_empty) _inteventqueue_notify(queue);
+    return enqueued;
+}
+
+bool inteventqueue_dequeue(IntEventQueue queue, int* out) {
+    if (_inteventqueue_not_exists(queue)) return false;
+
+    _inteventqueue_begin_drain(queue);
+    pthread_mutex_lock(&queue->lock);
+    bool dequeued = intqueue_dequeue(queue->queue, out);
+    if (intqueue_is_empty(queue->queue) && !dequeued) atomic_store_explicit(&queue->draining, false, memory_order_relaxed);
+    pthread_mutex_unlock(&queue->lock);
+    return dequeued;
+}
+
+// The usual way to consume: on every readiness event, drain in batches until this returns 0. The eventfd only
+// becomes readable again for values enqueued after that, so a consumer that stops early must come back without waiting
+size_t inteventqueue_dequeue_n(IntEventQueue queue, int* out, size_t size) {
+    if (_inteventqueue_not_exists(queue)) return 0;
+
+    _inteventqueue_begin_drain(queue);
+    pthread_mutex_lock(&queue->lock);
+    size_t taken = intqueue_dequeue_n(queue->queue, out, size);
+    if (intqueue_is_empty(queue->queue) && taken == 0) atomic_store_explicit(&queue->draining, false, memory_order_relaxed);
+    pthread_mutex_unlock(&queue->lock);
+    return taken;
+}
+
+size_t inteventqueue_size(const IntEventQueue queue) {
+    if (_inteventqueue_not_exists(queue)) return 0;
+
+    pthread_mutex_lock(&queue->lock);
+    size_t size = intqueue_size(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return size;
+}
+
+bool inteventqueue_is_empty(const IntEventQueue queue) {
+    return inteventqueue_size(queue) == 0;
+}
+
+size_t inteventqueue_capacity(const IntEventQueue queue) {
+    if (_inteventqueue_not_exists(queue)) return 0;
+
+    pthread_mutex_lock(&queue->lock);
+    size_t capacity = intqueue_capacity(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return capacity;
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "heap/intheap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "internal/memmngr.h"
+
+#define INITIAL_CAPACITY 8
+#define GROWTH_FACTOR 2
+#define MAX_CAPACITY (SIZE_MAX / sizeof (int))
+#define DEFAULT_ARITY 4
+#define MAX_ARITY 16
+
+// Implicit d-ary tree in one array, with d a power of two so parents and children are found with shifts.
+// Four children of four bytes share a cache line, so a heap half as deep costs barely more per level than a binary one
+struct _intheap {
+    int* data;
+    size_t size;
+    size_t capacity;
+    unsigned shift;
+    bool max;
+};
+
+static bool _intheap_not_exists(const IntHeap heap) {
+    return !heap;
+}
+
+bool intheap_is_empty(const IntHeap heap) {
+    return _intheap_not_exists(heap) || heap->size == 0;
+}
+
+static void _intheap_free(IntHeap heap) {
+    free(heap->data);
+    free(heap);
+}
+
+static bool _intheap_realloc(IntHeap heap, size_t new_capacity) {
+    int* new_data = (int*) realloc(heap->data, sizeof (int) * new_capacity);
+    if (!new_data) return false;
+
+    heap->data = new_data;
+    heap->capacity = new_capacity;
+    return true;
+}
+
+static bool _intheap_grow(IntHeap heap, size_t extra) {
+    if (extra > MAX_CAPACITY - heap->size) return false;
+
+    size_t required = heap->size + extra;
+    if (required <= heap->capacity) return true;
+
+    size_t new_capacity = heap->capacity ? heap->capacity : INITIAL_CAPACITY;
+    while (new_capacity < required) {
+        new_capacity = new_capacity > MAX_CAPACITY / GROWTH_FACTOR ? MAX_CAPACITY : new_capacity * GROWTH_FACTOR;
+    }
+    return _intheap_realloc(heap, new_capacity);
+}
+
+IntHeap intheap_with_arity(size_t arity, bool max) {
+    if (arity < 2 || arity > MAX_ARITY || (arity & (arity - 1)) != 0) return NULL;
+
+    IntHeap new_heap = (IntHeap) malloc(sizeof (struct _intheap));
+    if (_intheap_not_exists(new_heap)) return NULL;
+
+    if (!_memmngr_register(new_heap, (void (*)(void*)) _intheap_free)) {
+        free(new_heap);
+        return NULL;
+    }
+
+    *new_heap = (struct _intheap) {.data = NULL, .size = 0, .capacity = 0, .shift = __builtin_ctzll(arity), .max = max};
+    return new_heap;
+}
+
+IntHeap intheap_new(void) {
+    return intheap_with_arity(DEFAULT_ARITY, false);
+}
+
+IntHeap intheap_new_max(void) {
+    return intheap_with_arity(DEFAULT_ARITY, true);
+}
+
+void intheap_clear(IntHeap heap) {
+    if (_intheap_not_exists(heap)) return;
+    heap->size = 0;
+}
+
+bool intheap_reserve(IntHeap heap, size_t capacity) {
+    if (_intheap_not_exists(heap) || capacity > MAX_CAPACITY) return false;
+    return capacity <= heap->capacity || _intheap_realloc(heap, capacity);
+}
+
+// Whether a belongs closer to the top than b
+static bool _intheap_before(const IntHeap heap, int a, int b) {
+    return heap->max ? a > b : a < b;
+}
+
+// Both sifts carry the moving value in a hole instead of swapping, so each level costs one store
+static void _intheap_sift_up(IntHeap heap, size_t index) {
+    int value = heap->data[index];
+    while (index > 0) {
+        size_t parent = (index - 1) >> heap->shift;
+        if (!_intheap_before(heap, value, heap->data[parent])) break;
+
+        heap->data[index] = heap->data[parent];
+        index = parent;
+    }
+    heap->data[index] = value;
+}
+
+static void _intheap_sift_down(IntHeap heap, size_t index) {
+    int value = heap->data[index];
+    size_t arity = (size_t) 1 << heap->shift;
+
+    while (true) {
+        size_t first = (index << heap->shift) + 1;
+        if (first >= heap->size) break;
+
+        size_t last = first + arity < heap->size ? first + arity : heap->size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (_intheap_before(heap, heap->data[child], heap->data[best])) best = child;
+        }
+        if (!_intheap_before(heap, heap->data[best], value)) break;
+
+        heap->data[index] = heap->data[best];
+        index = best;
+    }
+    heap->data[index] = value;
+}
+
+// Bottom-up construction, O(n) since most nodes sit near the leaves and barely move
+static void _intheap_heapify(IntHeap heap) {
+    if (heap->size < 2) return;
+
+    for (size_t index = ((heap->size - 2) >> heap->shift) + 1; index-- > 0; ) _intheap_sift_down(heap, index);
+}
+
+IntHeap intheap_from_array(const int* arr, size_t size) {
+    return intheap_from_array_with(arr, size, DEFAULT_ARITY, false);
+}
+
+// The whole array lands in an empty heap, so push_n builds it with a single O(n) heapify
+IntHeap intheap_from_array_with(const int* arr, size_t size, size_t arity, bool max) {
+    if (!arr && size > 0) return NULL;
+
+    IntHeap new_heap = intheap_with_arity(arity, max);
+    if (_intheap_not_exists(new_heap)) return NULL;
+
+    if (!intheap_push_n(new_heap, arr, size)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_heap;
+}
+
+bool intheap_push(IntHeap heap, int value) {
+    if (_intheap_not_exists(heap) || !_intheap_grow(heap, 1)) return false;
+
+    heap->data[heap->size++] = value;
+    _intheap_sift_up(heap, heap->size - 1);
+    return true;
+}
+
+// A batch at least as large as the heap is cheaper to fold in by rebuilding everything than by sifting each value up
+bool intheap_push_n(IntHeap heap, const int* arr, size_t size) {
+    if (_intheap_not_exists(heap) || (!arr && size > 0)) return false;
+    if (size == 0) return true;
+    if (!_intheap_grow(heap, size)) return false;
+
+    size_t old_size = heap->size;
+    memcpy(heap->data + old_size, arr, sizeof (int) * size);
+    heap->size += size;
+
+    if (size >= old_size) {
+        _intheap_heapify(heap);
+    } else {
+        for (size_t index = old_size; index < heap->size; index++) _intheap_sift_up(heap, index);
+    }
+    return true;
+}
+
+bool intheap_pop(IntHeap heap, int* out) {
+    if (intheap_is_empty(heap)) return false;
+
+    if (out) *out = heap->data[0];
+    heap->size--;
+    if (heap->size > 0) {
+        heap->data[0] = heap->data[heap->size];
+        _intheap_sift_down(heap, 0);
+    }
+    return true;
+}
+
+bool intheap_peek(const IntHeap heap, int* out) {
+    if (intheap_is_empty(heap) || !out) return false;
+    *out = heap->data[0];
+    return true;
+}
+
+size_t intheap_size(const IntHeap heap) {
+    return _intheap_not_exists(heap) ? 0 : heap->size;
+}
+
+size_t intheap_capacity(const IntHeap heap) {
+    return _intheap_not_exists(heap) ? 0 : heap->capacity;
+}
+
+size_t intheap_arity(const IntHeap heap) {
+    return _intheap_not_exists(heap) ? 0 : (size_t) 1 << heap->shift;
+}
\ No newline at end of file
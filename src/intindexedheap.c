@@ -0,0 +1,236 @@
+#include "heap/intindexedheap.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include "internal/memmngr.h"
+
+#define INITIAL_CAPACITY 8
+#define GROWTH_FACTOR 2
+#define SHIFT 2
+#define ARITY (1 << SHIFT)
+#define ABSENT SIZE_MAX
+
+typedef struct _intheapentry {
+    int priority;
+    size_t id;
+} IntHeapEntry;
+
+// A 4-ary heap of (priority, id) entries plus a table from id to the entry's current slot, kept in step by every
+// move, so an id can be found, re-prioritized or removed in O(log n) without a search
+struct _intindexedheap {
+    IntHeapEntry* entries;
+    size_t size;
+    size_t capacity;
+    size_t* positions;
+    size_t positions_size;
+    bool max;
+};
+
+static bool _intindexedheap_not_exists(const IntIndexedHeap heap) {
+    return !heap;
+}
+
+bool intindexedheap_is_empty(const IntIndexedHeap heap) {
+    return _intindexedheap_not_exists(heap) || heap->size == 0;
+}
+
+static void _intindexedheap_free(IntIndexedHeap heap) {
+    free(heap->entries);
+    free(heap->positions);
+    free(heap);
+}
+
+static IntIndexedHeap _intindexedheap_create(bool max) {
+    IntIndexedHeap new_heap = (IntIndexedHeap) malloc(sizeof (struct _intindexedheap));
+    if (_intindexedheap_not_exists(new_heap)) return NULL;
+
+    if (!_memmngr_register(new_heap, (void (*)(void*)) _intindexedheap_free)) {
+        free(new_heap);
+        return NULL;
+    }
+
+    *new_heap = (struct _intindexedheap) {.entries = NULL, .size = 0, .capacity = 0, .positions = NULL, .positions_size = 0, .max = max};
+    return new_heap;
+}
+
+IntIndexedHeap intindexedheap_new(void) {
+    return _intindexedheap_create(false);
+}
+
+IntIndexedHeap intindexedheap_new_max(void) {
+    return _intindexedheap_create(true);
+}
+
+void intindexedheap_clear(IntIndexedHeap heap) {
+    if (_intindexedheap_not_exists(heap)) return;
+
+    for (size_t i = 0; i < heap->size; i++) heap->positions[heap->entries[i].id] = ABSENT;
+    heap->size = 0;
+}
+
+static bool _intindexedheap_grow(IntIndexedHeap heap) {
+    if (heap->size < heap->capacity) return true;
+    if (heap->capacity > SIZE_MAX / sizeof (IntHeapEntry) / GROWTH_FACTOR) return false;
+
+    size_t new_capacity = heap->capacity ? heap->capacity * GROWTH_FACTOR : INITIAL_CAPACITY;
+    IntHeapEntry* new_entries = (IntHeapEntry*) realloc(heap->entries, sizeof (IntHeapEntry) * new_capacity);
+    if (!new_entries) return false;
+
+    heap->entries = new_entries;
+    heap->capacity = new_capacity;
+    return true;
+}
+
+// The id table grows to cover the largest id seen, new slots start out absent. Capping ids keeps a stray large one
+// from turning into a multi-gigabyte table
+static bool _intindexedheap_cover(IntIndexedHeap heap, size_t id) {
+    if (id < heap->positions_size) return true;
+    if (id >= INTINDEXEDHEAP_ID_LIMIT) return false;
+
+    size_t new_size = heap->positions_size ? heap->positions_size : INITIAL_CAPACITY;
+    while (new_size <= id) new_size *= GROWTH_FACTOR;
+
+    size_t* new_positions = (size_t*) realloc(heap->positions, sizeof (size_t) * new_size);
+    if (!new_positions) return false;
+
+    for (size_t i = heap->positions_size; i < new_size; i++) new_positions[i] = ABSENT;
+    heap->positions = new_positions;
+    heap->positions_size = new_size;
+    return true;
+}
+
+static size_t _intindexedheap_position(const IntIndexedHeap heap, size_t id) {
+    return id < heap->positions_size ? heap->positions[id] : ABSENT;
+}
+
+static bool _intindexedheap_before(const IntIndexedHeap heap, int a, int b) {
+    return heap->max ? a > b : a < b;
+}
+
+static void _intindexedheap_place(IntIndexedHeap heap, size_t index, IntHeapEntry entry) {
+    heap->entries[index] = entry;
+    heap->positions[entry.id] = index;
+}
+
+static size_t _intindexedheap_sift_up(IntIndexedHeap heap, size_t index) {
+    IntHeapEntry entry = heap->entries[index];
+    while (index > 0) {
+        size_t parent = (index - 1) >> SHIFT;
+        if (!_intindexedheap_before(heap, entry.priority, heap->entries[parent].priority)) break;
+
+        _intindexedheap_place(heap, index, heap->entries[parent]);
+        index = parent;
+    }
+    _intindexedheap_place(heap, index, entry);
+    return index;
+}
+
+static void _intindexedheap_sift_down(IntIndexedHeap heap, size_t index) {
+    IntHeapEntry entry = heap->entries[index];
+    while (true) {
+        size_t first = (index << SHIFT) + 1;
+        if (first >= heap->size) break;
+
+        size_t last = first + ARITY < heap->size ? first + ARITY : heap->size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (_intindexedheap_before(heap, heap->entries[child].priority, heap->entries[best].priority)) best = child;
+        }
+        if (!_intindexedheap_before(heap, heap->entries[best].priority, entry.priority)) break;
+
+        _intindexedheap_place(heap, index, heap->entries[best]);
+        index = best;
+    }
+    _intindexedheap_place(heap, index, entry);
+}
+
+// Restores order around a slot whose priority changed in either direction
+static void _intindexedheap_fix(IntIndexedHeap heap, size_t index) {
+    if (_intindexedheap_sift_up(heap, index) == index) _intindexedheap_sift_down(heap, index);
+}
+
+static void _intindexedheap_remove_at(IntIndexedHeap heap, size_t index) {
+    heap->positions[heap->entries[index].id] = ABSENT;
+    heap->size--;
+    if (index == heap->size) return;
+
+    _intindexedheap_place(heap, index, heap->entries[heap->size]);
+    _intindexedheap_fix(heap, index);
+}
+
+// Each id can be queued once, pushing one that is already present fails instead of duplicating it
+bool intindexedheap_push(IntIndexedHeap heap, size_t id, int priority) {
+    if (_intindexedheap_not_exists(heap) || id == ABSENT || _intindexedheap_position(heap, id) != ABSENT) return false;
+    if (!_intindexedheap_cover(heap, id) || !_intindexedheap_grow(heap)) return false;
+
+    _intindexedheap_place(heap, heap->size, (IntHeapEntry) {.priority = priority, .id = id});
+    heap->size++;
+    _intindexedheap_sift_up(heap, heap->size - 1);
+    return true;
+}
+
+bool intindexedheap_pop(IntIndexedHeap heap, size_t* id, int* priority) {
+    if (!intindexedheap_peek(heap, id, priority)) return false;
+
+    _intindexedheap_remove_at(heap, 0);
+    return true;
+}
+
+bool intindexedheap_peek(const IntIndexedHeap heap, size_t* id, int* priority) {
+    if (intindexedheap_is_empty(heap)) return false;
+
+    if (id) *id = heap->entries[0].id;
+    if (priority) *priority = heap->entries[0].priority;
+    return true;
+}
+
+bool intindexedheap_remove(IntIndexedHeap heap, size_t id) {
+    if (_intindexedheap_not_exists(heap)) return false;
+
+    size_t index = _intindexedheap_position(heap, id);
+    if (index == ABSENT) return false;
+
+    _intindexedheap_remove_at(heap, index);
+    return true;
+}
+
+bool intindexedheap_contains(const IntIndexedHeap heap, size_t id) {
+    return !_intindexedheap_not_exists(heap) && _intindexedheap_position(heap, id) != ABSENT;
+}
+
+bool intindexedheap_priority(const IntIndexedHeap heap, size_t id, int* out) {
+    if (_intindexedheap_not_exists(heap) || !out) return false;
+
+    size_t index = _intindexedheap_position(heap, id);
+    if (index == ABSENT) return false;
+
+    *out = heap->entries[index].priority;
+    return true;
+}
+
+// Only moves an id towards the top (a lower priority in a min-heap, a higher one in a max-heap), so a single sift up
+// is enough; a priority that would move it the other way is rejected
+bool intindexedheap_decrease_key(IntIndexedHeap heap, size_t id, int priority) {
+    if (_intindexedheap_not_exists(heap)) return false;
+
+    size_t index = _intindexedheap_position(heap, id);
+    if (index == ABSENT || _intindexedheap_before(heap, heap->entries[index].priority, priority)) return false;
+
+    heap->entries[index].priority = priority;
+    _intindexedheap_sift_up(heap, index);
+    return true;
+}
+
+bool intindexedheap_update(IntIndexedHeap heap, size_t id, int priority) {
+    if (_intindexedheap_not_exists(heap)) return false;
+
+    size_t index = _intindexedheap_position(heap, id);
+    if (index == ABSENT) return false;
+
+    heap->entries[index].priority = priority;
+    _intindexedheap_fix(heap, index);
+    return true;
+}
+
+size_t intindexedheap_size(const IntIndexedHeap heap) {
+    return _intindexedheap_not_exists(heap) ? 0 : heap->size;
+}
\ No newline at end of file
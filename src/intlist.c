@@ -1,9 +1,18 @@
 #include "linkedlist/intlist.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
 #include "stack/intstack.h"
 #include "queue/intqueue.h"
+#include "queue/intdeque.h"
 #include "internal/memmngr.h"
+#include "internal/nodepool.h"
+#include "internal/threadpool.h"
+#include "internal/visit.h"
+#include "internal/fill.h"
+#include "internal/textio.h"
 
 typedef struct _intnode {
     int value;
@@ -11,10 +20,21 @@ typedef struct _intnode {
     struct _intnode* prev;
 } *IntNode;
 
+// The finger caches the last node reached by position, so sequential positional accesses resume from it
 struct _intlist {
     IntNode head;
     IntNode tail;
     size_t size;
+    IntNode finger;
+    size_t finger_index;
+    NodePool pool;
+};
+
+// A cursor at node == NULL is positioned past the last element (index == list size)
+struct _intlistcursor {
+    IntList list;
+    IntNode node;
+    size_t index;
 };
 
 static bool _intlist_not_exists(const IntList list) {
@@ -25,8 +45,8 @@ bool intlist_is_empty(const IntList list) {
     return _intlist_not_exists(list) || !list->head;
 }   
 
-static IntNode _intlist_create_node(int value, IntNode prev, IntNode next) {
-    IntNode new_node = (IntNode) malloc(sizeof (struct _intnode));
+static IntNode _intlist_create_node(IntList list, int value, IntNode prev, IntNode next) {
+    IntNode new_node = (IntNode) _nodepool_alloc(list->pool);
     if (!new_node) return NULL;
 
     *new_node = (struct _intnode) {.value = value, .prev = prev, .next = next};
@@ -35,26 +55,42 @@ static IntNode _intlist_create_node(int value, IntNode prev, IntNode next) {
 
 static void _intlist_free(IntList list) {
     intlist_clear(list);
+    _nodepool_destroy(list->pool);
     free(list);
 }
 
 static IntNode _intlist_node_at(const IntList list, size_t index) {
+    size_t from_finger = !list->finger ? list->size : index < list->finger_index ? list->finger_index - index : index - list->finger_index;
+    size_t steps;
+
     IntNode node;
-    if (index < list->size / 2) {
+    if (from_finger < index && from_finger < list->size - index - 1) {
+        node = list->finger;
+        steps = from_finger;
+        if (index < list->finger_index) {
+            while (steps--) node = node->prev;
+        } else {
+            while (steps--) node = node->next;
+        }
+    } else if (index < list->size / 2) {
         node = list->head;
-        while (index--) node = node->next;
+        steps = index;
+        while (steps--) node = node->next;
     } else {
         node = list->tail;
-        index = list->size - index - 1;
-        while (index--) node = node->prev;
+        steps = list->size - index - 1;
+        while (steps--) node = node->prev;
     }
+
+    list->finger = node;
+    list->finger_index = index;
     return node;
 }
 
 static bool _intlist_link_before(IntList list, int value, IntNode succ) {
     IntNode pred = succ ? succ->prev : list->tail;
 
-    IntNode new_node = _intlist_create_node(value, pred, succ);
+    IntNode new_node = _intlist_create_node(list, value, pred, succ);
     if (!new_node) return false;
 
     if (!pred)  list->head = new_node;
@@ -63,6 +99,12 @@ static bool _intlist_link_before(IntList list, int value, IntNode succ) {
     if (!succ)  list->tail = new_node;
     else        succ->prev = new_node;
 
+    // Appending leaves the finger untouched; a front insertion only shifts it by one
+    if (succ && list->finger) {
+        if (!pred)  list->finger_index++;
+        else        list->finger = NULL;
+    }
+
     list->size++;
     return true;
 }
@@ -77,20 +119,90 @@ static void _intlist_unlink_node(IntList list, IntNode node) {
     if (!succ)  list->tail = pred;
     else        succ->prev = pred;
 
-    free(node);
+    // Removing the tail leaves the finger untouched; removing the head only shifts it by one
+    if (node == list->finger || (pred && succ)) list->finger = NULL;
+    else if (!pred && list->finger)             list->finger_index--;
+
+    _nodepool_free(node);
     list->size--;
 }
 
+// Links size nodes after the tail from a single pool request and returns the first one; without values they are zeroed
+static IntNode _intlist_append_nodes(IntList list, const int* values, size_t size) {
+    if (size == 0 || !_nodepool_reserve(list->pool, size)) return NULL;
+
+    IntNode first = NULL, pred = list->tail;
+    for (size_t i = 0; i < size; i++) {
+        IntNode node = (IntNode) _nodepool_alloc(list->pool);
+        *node = (struct _intnode) {.value = values ? values[i] : 0, .prev = pred, .next = NULL};
+
+        if (!pred)  list->head = node;
+        else        pred->next = node;
+        if (!first) first = node;
+        pred = node;
+    }
+
+    list->tail = pred;
+    list->size += size;
+    return first;
+}
+
+// Links the run first..last before succ (after the tail when succ is NULL) without allocating or copying
+static void _intlist_link_run(IntList list, IntNode first, IntNode last, size_t size, IntNode succ) {
+    IntNode pred = succ ? succ->prev : list->tail;
+    first->prev = pred;
+    last->next = succ;
+
+    if (!pred)  list->head = first;
+    else        pred->next = first;
+
+    if (!succ)  list->tail = last;
+    else        succ->prev = last;
+
+    list->size += size;
+}
+
+static void _intlist_detach(IntList list) {
+    list->head = list->tail = list->finger = NULL;
+    list->size = 0;
+}
+
+bool _intlist_push_reversed(IntList list, const int* arr, size_t size) {
+    if (size == 0) return true;
+
+    IntNode node = _intlist_append_nodes(list, NULL, size);
+    if (!node) return false;
+
+    for (size_t i = size; i-- > 0; node = node->next) node->value = arr[i];
+    return true;
+}
+
+static int* _intlist_values(const IntList list) {
+    int* arr = (int*) malloc(sizeof (int) * list->size);
+    if (!arr) return NULL;
+
+    IntNode curr = list->head;
+    for (size_t i = 0; i < list->size; i++, curr = curr->next) arr[i] = curr->value;
+    return arr;
+}
+
 IntList intlist_new(void) {
     IntList new_list = (IntList) malloc(sizeof (struct _intlist));
     if (_intlist_not_exists(new_list)) return NULL;
 
+    NodePool pool = _nodepool_new(sizeof (struct _intnode));
+    if (!pool) {
+        free(new_list);
+        return NULL;
+    }
+
     if (!_memmngr_register(new_list, (void (*)(void*)) _intlist_free)) {
+        _nodepool_destroy(pool);
         free(new_list);
         return NULL;
     }
 
-    *new_list = (struct _intlist) {.head = NULL, .tail = NULL, .size = 0};
+    *new_list = (struct _intlist) {.head = NULL, .tail = NULL, .size = 0, .finger = NULL, .finger_index = 0, .pool = pool};
     return new_list;
 }
 
@@ -99,10 +211,10 @@ void intlist_clear(IntList list) {
 
     for (IntNode curr = list->head, next; curr; curr = next) {
         next = curr->next;
-        free(curr);
+        _nodepool_free(curr);
     }
 
-    list->head = list->tail = NULL;
+    list->head = list->tail = list->finger = NULL;
     list->size = 0;
 }
 
@@ -114,8 +226,72 @@ bool intlist_push(IntList list, int value) {
     return !_intlist_not_exists(list) && _intlist_link_before(list, value, NULL);
 }
 
+bool intlist_push_n(IntList list, const int* arr, size_t size) {
+    if (_intlist_not_exists(list) || (!arr && size > 0)) return false;
+    return size == 0 || _intlist_append_nodes(list, arr, size);
+}
+
+bool intlist_extend(IntList list, const IntList other) {
+    if (_intlist_not_exists(list) || _intlist_not_exists(other)) return false;
+    if (other->size == 0) return true;
+
+    // Source nodes are read before the appended ones, so a list can extend itself
+    size_t size = other->size;
+    IntNode src = other->head, dst = _intlist_append_nodes(list, NULL, size);
+    if (!dst) return false;
+
+    for (size_t i = 0; i < size; i++, src = src->next, dst = dst->next) dst->value = src->value;
+    return true;
+}
+
+bool intlist_concat(IntList dst, IntList src) {
+    return !_intlist_not_exists(dst) && intlist_splice(dst, dst->size, src);
+}
+
+bool intlist_splice(IntList dst, size_t pos, IntList src) {
+    if (_intlist_not_exists(dst) || _intlist_not_exists(src) || dst == src || pos > dst->size) return false;
+    if (src->size == 0) return true;
+
+    IntNode succ = pos < dst->size ? _intlist_node_at(dst, pos) : NULL;
+    _intlist_link_run(dst, src->head, src->tail, src->size, succ);
+
+    // Positions before pos are untouched and the rest shift by the length of the stolen run
+    if (dst->finger && dst->finger_index >= pos) dst->finger_index += src->size;
+
+    _intlist_detach(src);
+    return true;
+}
+
+IntList intlist_split_at(IntList list, size_t index) {
+    if (_intlist_not_exists(list) || index > list->size) return NULL;
+
+    IntList rest = intlist_new();
+    if (_intlist_not_exists(rest) || index == list->size) return rest;
+
+    IntNode first = _intlist_node_at(list, index);
+    IntNode last = list->tail;
+    size_t size = list->size - index;
+
+    list->tail = first->prev;
+    if (!list->tail)    list->head = NULL;
+    else                list->tail->next = NULL;
+    list->size = index;
+
+    // The finger was left on the first moved node, so it only stays meaningful for the new list
+    list->finger = NULL;
+    _intlist_link_run(rest, first, last, size, NULL);
+    return rest;
+}
+
 bool intlist_push_at(IntList list, int value, size_t index) {
-    return !_intlist_not_exists(list) && index <= list->size && _intlist_link_before(list, value, index < list->size ? _intlist_node_at(list, index) : NULL);
+    if (_intlist_not_exists(list) || index > list->size) return false;
+
+    IntNode succ = index < list->size ? _intlist_node_at(list, index) : NULL;
+    if (!_intlist_link_before(list, value, succ)) return false;
+
+    list->finger = succ ? succ->prev : list->tail;
+    list->finger_index = index;
+    return true;
 }
 
 bool intlist_front(const IntList list, int* out) {
@@ -168,7 +344,19 @@ void intlist_pop(IntList list) {
 
 void intlist_pop_at(IntList list, size_t index) {
     if (intlist_is_empty(list) || index >= list->size) return;
-    _intlist_unlink_node(list, _intlist_node_at(list, index));    
+
+    IntNode node = _intlist_node_at(list, index);
+    IntNode pred = node->prev, succ = node->next;
+    _intlist_unlink_node(list, node);
+
+    // Keep the finger next to the removed position so nearby accesses stay cheap
+    if (succ) {
+        list->finger = succ;
+        list->finger_index = index;
+    } else if (pred) {
+        list->finger = pred;
+        list->finger_index = index - 1;
+    }
 }
 
 size_t intlist_size(IntList list) {
@@ -187,23 +375,134 @@ void intlist_reverse(IntList list) {
     IntNode head = list->head;
     list->head = list->tail;
     list->tail = head;
+
+    if (list->finger) list->finger_index = list->size - list->finger_index - 1;
+}
+
+// Below this size the key buffers of the radix path cost more than the comparisons they save
+#define RADIX_SORT_THRESHOLD 256
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_PASSES (sizeof (int) * 8 / RADIX_BITS)
+
+// Merges two sorted runs linked through next only, taking from the first run on ties to stay stable
+static IntNode _intlist_merge(IntNode a, IntNode b, int (*compare_func)(int a, int b, void* ctx), void* ctx) {
+    struct _intnode head;
+    IntNode tail = &head;
+    while (a && b) {
+        if ((compare_func ? compare_func(a->value, b->value, ctx) > 0 : a->value > b->value)) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
+
+// Bottom-up merge sort that relinks the existing nodes without allocating; equal elements keep their relative order.
+// Runs are merged as soon as two of the same length exist, so most merges work on nodes that are still in cache.
+static void _intlist_merge_sort(IntList list, int (*compare_func)(int a, int b, void* ctx), void* ctx) {
+    IntNode runs[sizeof (size_t) * 8] = {NULL};
+    size_t max_run = 0;
+
+    for (IntNode curr = list->head, next; curr; curr = next) {
+        next = curr->next;
+        curr->next = NULL;
+
+        // runs[i] holds 2^i nodes that all precede the carry, which mirrors incrementing a binary counter
+        IntNode carry = curr;
+        size_t i = 0;
+        for (; runs[i]; i++) {
+            carry = _intlist_merge(runs[i], carry, compare_func, ctx);
+            runs[i] = NULL;
+        }
+        runs[i] = carry;
+        if (i > max_run) max_run = i;
+    }
+
+    IntNode head = NULL;
+    for (size_t i = 0; i <= max_run; i++) {
+        if (runs[i]) head = _intlist_merge(runs[i], head, compare_func, ctx);
+    }
+
+    IntNode prev = NULL;
+    for (IntNode curr = head; curr; prev = curr, curr = curr->next) curr->prev = prev;
+
+    list->head = head;
+    list->tail = prev;
+    list->finger = NULL;
+}
+
+// LSD radix sort on the values alone: nodes stay where they are and receive the sorted values in order
+static bool _intlist_radix_sort(IntList list) {
+    uint32_t* keys = (uint32_t*) malloc(sizeof (uint32_t) * list->size * 2);
+    if (!keys) return false;
+
+    uint32_t* buffer = keys + list->size;
+    size_t counts[RADIX_PASSES][RADIX_BUCKETS] = {{0}};
+
+    // Flipping the sign bit makes negative values order before positive ones as unsigned keys
+    IntNode curr = list->head;
+    for (size_t i = 0; i < list->size; i++, curr = curr->next) {
+        keys[i] = (uint32_t) curr->value ^ UINT32_C(0x80000000);
+        for (size_t pass = 0; pass < RADIX_PASSES; pass++) counts[pass][(keys[i] >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++;
+    }
+
+    for (size_t pass = 0; pass < RADIX_PASSES; pass++) {
+        size_t shift = pass * RADIX_BITS;
+        size_t* count = counts[pass];
+        if (count[(keys[0] >> shift) & (RADIX_BUCKETS - 1)] == list->size) continue;
+
+        for (size_t bucket = 0, offset = 0; bucket < RADIX_BUCKETS; bucket++) {
+            size_t bucket_size = count[bucket];
+            count[bucket] = offset;
+            offset += bucket_size;
+        }
+        for (size_t i = 0; i < list->size; i++) buffer[count[(keys[i] >> shift) & (RADIX_BUCKETS - 1)]++] = keys[i];
+
+        uint32_t* sorted = buffer;
+        buffer = keys;
+        keys = sorted;
+    }
+
+    curr = list->head;
+    for (size_t i = 0; i < list->size; i++, curr = curr->next) curr->value = (int) (keys[i] ^ UINT32_C(0x80000000));
+
+    free(keys < buffer ? keys : buffer);
+    return true;
+}
+
+void intlist_sort(IntList list) {
+    if (_intlist_not_exists(list) || list->size < 2) return;
+    if (list->size >= RADIX_SORT_THRESHOLD && _intlist_radix_sort(list)) return;
+
+    _intlist_merge_sort(list, NULL, NULL);
+}
+
+void intlist_sort_by(IntList list, int (*compare_func)(int a, int b, void* ctx), void* ctx) {
+    if (_intlist_not_exists(list) || list->size < 2) return;
+    if (!compare_func) {
+        intlist_sort(list);
+        return;
+    }
+
+    _intlist_merge_sort(list, compare_func, ctx);
 }
 
 int* intlist_to_array(const IntList list) {
     if (intlist_is_empty(list)) return NULL;
 
-    size_t arr_size = list->size;
-    
-    int* arr = (int*) malloc(sizeof (int) * arr_size);
+    int* arr = _intlist_values(list);
     if (!arr) return NULL;
 
     if (!_memmngr_register(arr, free)) {
         free(arr);
         return NULL;
     }
-    
-    IntNode curr = list->head;
-    for (size_t i = 0; i < arr_size; i++, curr = curr->next) arr[i] = curr->value;
     return arr;
 }
 
@@ -211,14 +510,15 @@ IntStack intlist_to_stack(const IntList list) {
     if (_intlist_not_exists(list)) return NULL;
     
     IntStack new_stack = intstack_new();
-    if (!new_stack) return NULL;
-    
-    for (IntNode curr = list->head; curr; curr = curr->next) {
-        if (!intstack_push(new_stack, curr->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
-    }    
+    if (!new_stack || intlist_is_empty(list)) return new_stack;
+
+    int* slots = _intstack_fill(new_stack, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    for (IntNode curr = list->head; curr; curr = curr->next) *slots++ = curr->value;
     return new_stack;
 }
 
@@ -226,14 +526,85 @@ IntQueue intlist_to_queue(const IntList list) {
     if (_intlist_not_exists(list)) return NULL;
     
     IntQueue new_queue = intqueue_new();
-    if (!new_queue) return NULL;
-    
+    if (!new_queue || intlist_is_empty(list)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    for (IntNode curr = list->head; curr; curr = curr->next) *slots++ = curr->value;
+    return new_queue;
+}
+
+#define COPY_BATCH 256
+
+// Nodes are not contiguous, so values are gathered into a small on-stack batch and each batch appended in one call
+IntDeque intlist_to_deque(const IntList list) {
+    if (_intlist_not_exists(list)) return NULL;
+
+    IntDeque new_deque = intdeque_new();
+    if (!new_deque || intlist_is_empty(list)) return new_deque;
+
+    int batch[COPY_BATCH];
+    size_t count = 0;
     for (IntNode curr = list->head; curr; curr = curr->next) {
-        if (!intqueue_enqueue(new_queue, curr->value)) {
+        batch[count++] = curr->value;
+        if (count < COPY_BATCH && curr->next) continue;
+
+        if (!intdeque_push_back_n(new_deque, batch, count)) {
             _memmngr_rollback();
             return NULL;
         }
-    }    
+        count = 0;
+    }
+    return new_deque;
+}
+
+// Writes the values into slots while freeing their nodes, then gives the emptied slabs back to the system
+static void _intlist_drain(IntList list, int* slots) {
+    for (IntNode curr = list->head, next; curr; curr = next) {
+        next = curr->next;
+        *slots++ = curr->value;
+        _nodepool_free(curr);
+    }
+
+    _intlist_detach(list);
+    _nodepool_release(list->pool);
+}
+
+// Not zero-allocation moves: stacks and queues are arrays and cannot reuse the nodes, so these allocate the new storage
+// and copy each value once straight into it as its node is freed. Only stack <-> queue hands its storage over unchanged
+IntStack intlist_into_stack(IntList list) {
+    if (_intlist_not_exists(list)) return NULL;
+
+    IntStack new_stack = intstack_new();
+    if (!new_stack || intlist_is_empty(list)) return new_stack;
+
+    int* slots = _intstack_fill(new_stack, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intlist_drain(list, slots);
+    return new_stack;
+}
+
+IntQueue intlist_into_queue(IntList list) {
+    if (_intlist_not_exists(list)) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (!new_queue || intlist_is_empty(list)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intlist_drain(list, slots);
     return new_queue;
 }
 
@@ -242,12 +613,10 @@ IntList intlist_from_array(int* arr, size_t size) {
 
     IntList new_list = intlist_new();
     if (_intlist_not_exists(new_list)) return NULL;
-    
-    for (size_t i = 0; i < size; i++) {
-        if (!intlist_push(new_list, arr[i])) {
-            _memmngr_rollback();
-            return NULL;
-        }
+
+    if (!intlist_push_n(new_list, arr, size)) {
+        _memmngr_rollback();
+        return NULL;
     }
     return new_list;
 }
@@ -263,13 +632,11 @@ IntList intlist_copy(const IntList list) {
     
     IntList copy = intlist_new();
     if (_intlist_not_exists(copy)) return NULL;
-    
-    for (IntNode curr = list->head; curr; curr = curr->next) {
-        if (!intlist_push(copy, curr->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
-    }   
+
+    if (!intlist_extend(copy, list)) {
+        _memmngr_rollback();
+        return NULL;
+    }
     return copy;
 }
 
@@ -278,14 +645,15 @@ IntList intlist_map(const IntList list, int (*callback_func)(int value)) {
     if (!callback_func) return intlist_copy(list);
 
     IntList new_list = intlist_new();
-    if (_intlist_not_exists(new_list)) return NULL;
-    
-    for (IntNode curr = list->head; curr; curr = curr->next) {
-        if (!intlist_push(new_list, callback_func(curr->value))) {
-            _memmngr_rollback();
-            return NULL;
-        }
+    if (_intlist_not_exists(new_list) || list->size == 0) return new_list;
+
+    IntNode dst = _intlist_append_nodes(new_list, NULL, list->size);
+    if (!dst) {
+        _memmngr_rollback();
+        return NULL;
     }
+
+    for (IntNode src = list->head; src; src = src->next, dst = dst->next) dst->value = callback_func(src->value);
     return new_list;
 }
 
@@ -311,13 +679,19 @@ IntList intlist_zip(const IntList list1, const IntList list2) {
     if (_intlist_not_exists(list1) || _intlist_not_exists(list2)) return NULL;
 
     IntList new_list = intlist_new();
-    if (_intlist_not_exists(new_list)) return NULL;
-    
+    size_t pairs = list1->size < list2->size ? list1->size : list2->size;
+    if (_intlist_not_exists(new_list) || pairs == 0) return new_list;
+
+    IntNode dst = _intlist_append_nodes(new_list, NULL, 2 * pairs);
+    if (!dst) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
     for (IntNode curr1 = list1->head, curr2 = list2->head; curr1 && curr2; curr1 = curr1->next, curr2 = curr2->next) {
-        if (!intlist_push(new_list, curr1->value) || !intlist_push(new_list, curr2->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
+        dst->value = curr1->value;
+        dst->next->value = curr2->value;
+        dst = dst->next->next;
     }
     return new_list;
 }
@@ -345,12 +719,250 @@ long long intlist_reduce(const IntList list, long long (*reduce_func)(long long
     return acc;
 }
 
-static long long _intlist_sum_reduce(long long acc, int value) {
-    return acc + value;
+// Batch callbacks see values copied into a contiguous buffer, so they can be vectorized and cost one call per block
+#define BATCH_SIZE 256
+
+// Copies up to BATCH_SIZE values starting at curr and returns the node following the last one copied
+static IntNode _intlist_gather(IntNode curr, int* batch, size_t* size) {
+    *size = 0;
+    for (; curr && *size < BATCH_SIZE; curr = curr->next) batch[(*size)++] = curr->value;
+    return curr;
+}
+
+void intlist_foreach_batch(IntList list, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx) {
+    if (_intlist_not_exists(list) || !batch_func) return;
+
+    int batch[BATCH_SIZE];
+    for (IntNode curr = list->head, next; curr; curr = next) {
+        size_t size;
+        next = _intlist_gather(curr, batch, &size);
+        batch_func(batch, size, ctx);
+        for (size_t i = 0; i < size; i++, curr = curr->next) curr->value = batch[i];
+    }
+}
+
+IntList intlist_map_batch(const IntList list, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx) {
+    if (_intlist_not_exists(list)) return NULL;
+    if (!batch_func) return intlist_copy(list);
+
+    IntList new_list = intlist_new();
+    if (_intlist_not_exists(new_list) || list->size == 0) return new_list;
+
+    IntNode dst = _intlist_append_nodes(new_list, NULL, list->size);
+    if (!dst) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    int batch[BATCH_SIZE];
+    for (IntNode src = list->head; src; ) {
+        size_t size;
+        src = _intlist_gather(src, batch, &size);
+        batch_func(batch, size, ctx);
+        for (size_t i = 0; i < size; i++, dst = dst->next) dst->value = batch[i];
+    }
+    return new_list;
+}
+
+IntList intlist_filter_batch(const IntList list, void (*batch_func)(const int* values, bool* keep, size_t size, void* ctx), void* ctx) {
+    if (_intlist_not_exists(list)) return NULL;
+    if (!batch_func) return intlist_copy(list);
+
+    IntList new_list = intlist_new();
+    if (_intlist_not_exists(new_list)) return NULL;
+
+    int batch[BATCH_SIZE];
+    bool keep[BATCH_SIZE];
+    for (IntNode curr = list->head; curr; ) {
+        size_t size;
+        curr = _intlist_gather(curr, batch, &size);
+        batch_func(batch, keep, size, ctx);
+
+        size_t kept = 0;
+        for (size_t i = 0; i < size; i++) {
+            if (keep[i]) batch[kept++] = batch[i];
+        }
+
+        if (kept > 0 && !_intlist_append_nodes(new_list, batch, kept)) {
+            _memmngr_rollback();
+            return NULL;
+        }
+    }
+    return new_list;
+}
+
+long long intlist_reduce_batch(const IntList list, long long (*batch_func)(long long acc, const int* values, size_t size, void* ctx), long long initial, void* ctx) {
+    if (_intlist_not_exists(list) || !batch_func) return initial;
+
+    long long acc = initial;
+    int batch[BATCH_SIZE];
+    for (IntNode curr = list->head; curr; ) {
+        size_t size;
+        curr = _intlist_gather(curr, batch, &size);
+        acc = batch_func(acc, batch, size, ctx);
+    }
+    return acc;
+}
+
+void _intlist_visit(const IntList list, IntVisitor visit_func, void* ctx) {
+    if (_intlist_not_exists(list)) return;
+
+    for (IntNode curr = list->head; curr && visit_func(curr->value, ctx); curr = curr->next);
 }
 
 long long intlist_sum(const IntList list) {
-    return intlist_reduce(list, _intlist_sum_reduce, 0);
+    if (_intlist_not_exists(list)) return 0;
+
+    long long sum = 0;
+    for (IntNode curr = list->head; curr; sum += curr->value, curr = curr->next);
+    return sum;
+}
+
+// A contiguous run of the source list handed to one parallel task, with whatever that task produces for it
+typedef struct _intlistchunk {
+    IntNode first;
+    size_t size;
+    IntNode out;
+    bool* keep;
+    long long acc;
+} IntListChunk;
+
+typedef struct _intlistjob {
+    IntListChunk* chunks;
+    int (*callback_func)(int value);
+    bool (*predicate_func)(int value);
+    long long (*reduce_func)(long long acc, int value);
+    long long identity;
+} IntListJob;
+
+// Splits the list into evenly sized runs in a single walk, pairing each with its counterpart in out when given
+static IntListChunk* _intlist_split(const IntList list, IntNode out, bool* keep, size_t* chunks_num) {
+    size_t chunks = _threadpool_chunks(list->size);
+
+    IntListChunk* chunk_arr = (IntListChunk*) malloc(sizeof (IntListChunk) * chunks);
+    if (!chunk_arr) return NULL;
+
+    IntNode curr = list->head;
+    for (size_t i = 0, start = 0; i < chunks; i++) {
+        size_t end = (i + 1) * list->size / chunks;
+        chunk_arr[i] = (IntListChunk) {.first = curr, .size = end - start, .out = out, .keep = keep ? keep + start : NULL};
+
+        for (; start < end; start++) {
+            curr = curr->next;
+            if (out) out = out->next;
+        }
+    }
+
+    *chunks_num = chunks;
+    return chunk_arr;
+}
+
+static void _intlist_par_map_task(void* arg, size_t index) {
+    IntListJob* job = arg;
+    IntListChunk* chunk = &job->chunks[index];
+
+    IntNode src = chunk->first, dst = chunk->out;
+    for (size_t i = 0; i < chunk->size; i++, src = src->next, dst = dst->next) dst->value = job->callback_func(src->value);
+}
+
+static void _intlist_par_filter_task(void* arg, size_t index) {
+    IntListJob* job = arg;
+    IntListChunk* chunk = &job->chunks[index];
+
+    IntNode curr = chunk->first;
+    for (size_t i = 0; i < chunk->size; i++, curr = curr->next) chunk->keep[i] = job->predicate_func(curr->value);
+}
+
+static void _intlist_par_reduce_task(void* arg, size_t index) {
+    IntListJob* job = arg;
+    IntListChunk* chunk = &job->chunks[index];
+
+    long long acc = job->identity;
+    IntNode curr = chunk->first;
+    for (size_t i = 0; i < chunk->size; i++, curr = curr->next) acc = job->reduce_func(acc, curr->value);
+    chunk->acc = acc;
+}
+
+IntList intlist_par_map(const IntList list, int (*callback_func)(int value)) {
+    if (_intlist_not_exists(list) || !callback_func || list->size < PAR_SEQUENTIAL_CUTOFF) return intlist_map(list, callback_func);
+
+    IntList new_list = intlist_new();
+    if (_intlist_not_exists(new_list)) return NULL;
+
+    size_t chunks_num;
+    IntNode out = _intlist_append_nodes(new_list, NULL, list->size);
+    IntListChunk* chunks = out ? _intlist_split(list, out, NULL, &chunks_num) : NULL;
+    if (!chunks) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    IntListJob job = {.chunks = chunks, .callback_func = callback_func};
+    _threadpool_run(_intlist_par_map_task, &job, chunks_num);
+
+    free(chunks);
+    return new_list;
+}
+
+IntList intlist_par_filter(const IntList list, bool (*predicate_func)(int value)) {
+    if (_intlist_not_exists(list) || !predicate_func || list->size < PAR_SEQUENTIAL_CUTOFF) return intlist_filter(list, predicate_func);
+
+    IntList new_list = intlist_new();
+    if (_intlist_not_exists(new_list)) return NULL;
+
+    // Predicates run in parallel into a flag per element; the kept values are then appended in their original order
+    size_t chunks_num;
+    bool* keep = (bool*) malloc(sizeof (bool) * list->size);
+    IntListChunk* chunks = keep ? _intlist_split(list, NULL, keep, &chunks_num) : NULL;
+    if (!chunks) {
+        free(keep);
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    IntListJob job = {.chunks = chunks, .predicate_func = predicate_func};
+    _threadpool_run(_intlist_par_filter_task, &job, chunks_num);
+    free(chunks);
+
+    size_t kept = 0;
+    for (size_t i = 0; i < list->size; i++) kept += keep[i];
+
+    IntNode dst = kept > 0 ? _intlist_append_nodes(new_list, NULL, kept) : NULL;
+    if (kept > 0 && !dst) {
+        free(keep);
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    IntNode src = list->head;
+    for (size_t i = 0; i < list->size; i++, src = src->next) {
+        if (!keep[i]) continue;
+
+        dst->value = src->value;
+        dst = dst->next;
+    }
+
+    free(keep);
+    return new_list;
+}
+
+long long intlist_par_reduce(const IntList list, long long (*reduce_func)(long long acc, int value), long long (*combine_func)(long long acc1, long long acc2), long long identity) {
+    if (_intlist_not_exists(list) || !reduce_func) return identity;
+    if (!combine_func || list->size < PAR_SEQUENTIAL_CUTOFF) return intlist_reduce(list, reduce_func, identity);
+
+    size_t chunks_num;
+    IntListChunk* chunks = _intlist_split(list, NULL, NULL, &chunks_num);
+    if (!chunks) return intlist_reduce(list, reduce_func, identity);
+
+    IntListJob job = {.chunks = chunks, .reduce_func = reduce_func, .identity = identity};
+    _threadpool_run(_intlist_par_reduce_task, &job, chunks_num);
+
+    // Partial results are combined left to right, so only associativity is required of combine_func
+    long long acc = identity;
+    for (size_t i = 0; i < chunks_num; i++) acc = combine_func(acc, chunks[i].acc);
+
+    free(chunks);
+    return acc;
 }
 
 void intlist_print(const IntList list) {
@@ -358,11 +970,111 @@ void intlist_print(const IntList list) {
         printf("NULL");
         return;
     }
+    intlist_write(list, stdout, " -> ");
+}
+
+// Without a separator values are written one per line
+bool intlist_write(const IntList list, FILE* stream, const char* sep) {
+    if (_intlist_not_exists(list) || !stream) return false;
+    if (!sep) sep = "\n";
 
+    TextWriter writer;
+    _textio_writer_init(&writer, stream);
+
+    size_t sep_len = strlen(sep);
     for (IntNode curr = list->head; curr; curr = curr->next) {
-        printf("%d", curr->value);
-        if (curr->next) printf(" -> ");
+        _textio_write_int(&writer, curr->value);
+        if (curr->next) _textio_write(&writer, sep, sep_len);
     }
+    return _textio_flush(&writer);
+}
+
+// Copies whatever part of data still fits in front of the terminator slot
+static void _intlist_put_clipped(char* buf, size_t size, size_t at, const char* data, size_t length) {
+    if (!buf || at + 1 >= size) return;
+    memcpy(buf + at, data, length < size - 1 - at ? length : size - 1 - at);
+}
+
+// Behaves like snprintf: the text is truncated to fit, always terminated, and the full length is returned
+size_t intlist_format_into(const IntList list, char* buf, size_t size, const char* sep) {
+    if (!sep) sep = "\n";
+
+    size_t sep_len = strlen(sep), length = 0;
+    char digits[TEXTIO_INT_MAX_LEN];
+    for (IntNode curr = _intlist_not_exists(list) ? NULL : list->head; curr; curr = curr->next) {
+        if (buf && length + TEXTIO_INT_MAX_LEN < size) {
+            length += _textio_format_int(curr->value, buf + length);
+        } else {
+            size_t digits_len = _textio_format_int(curr->value, digits);
+            _intlist_put_clipped(buf, size, length, digits, digits_len);
+            length += digits_len;
+        }
+
+        if (curr->next) {
+            _intlist_put_clipped(buf, size, length, sep, sep_len);
+            length += sep_len;
+        }
+    }
+
+    if (buf && size > 0) buf[length < size ? length : size - 1] = '\0';
+    return length;
+}
+
+#define READ_CHUNK_SIZE 65536
+#define READ_BATCH_SIZE 4096
+
+// Integers are maximal digit runs, negative when a '-' comes right before them; every other byte separates them
+IntList intlist_read(FILE* stream) {
+    if (!stream) return NULL;
+
+    IntList new_list = intlist_new();
+    if (_intlist_not_exists(new_list)) return NULL;
+
+    char* chunk = (char*) malloc(READ_CHUNK_SIZE);
+    int* values = (int*) malloc(sizeof (int) * READ_BATCH_SIZE);
+    bool ok = chunk && values;
+
+    // A number may straddle two chunks, so the scanner state lives outside the read loop
+    long long magnitude = 0;
+    bool negative = false, in_number = false;
+    size_t count = 0, read;
+    while (ok && (read = fread(chunk, 1, READ_CHUNK_SIZE, stream)) > 0) {
+        for (size_t i = 0; i < read && ok; i++) {
+            unsigned int digit = (unsigned char) chunk[i] - '0';
+            if (digit < 10) {
+                magnitude = magnitude * 10 + digit;
+                in_number = true;
+                ok = magnitude <= (long long) INT_MAX + 1;
+                continue;
+            }
+
+            if (in_number) {
+                ok = negative || magnitude <= INT_MAX;
+                values[count++] = negative ? (int) -magnitude : (int) magnitude;
+                if (count == READ_BATCH_SIZE) {
+                    ok = ok && intlist_push_n(new_list, values, count);
+                    count = 0;
+                }
+                magnitude = 0;
+                in_number = false;
+            }
+            negative = chunk[i] == '-';
+        }
+    }
+
+    if (ok && in_number) {
+        ok = negative || magnitude <= INT_MAX;
+        values[count++] = negative ? (int) -magnitude : (int) magnitude;
+    }
+    ok = ok && !ferror(stream) && intlist_push_n(new_list, values, count);
+
+    free(chunk);
+    free(values);
+    if (!ok) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_list;
 }
 
 bool intlist_contains(const IntList list, int target) {
@@ -377,4 +1089,86 @@ bool intlist_equals(const IntList list1, const IntList list2) {
 
     for (IntNode curr1 = list1->head, curr2 = list2->head; curr1 && curr2; curr1 = curr1->next, curr2 = curr2->next) if (curr1->value != curr2->value) return false;
     return true;
+}
+
+static void _intlist_cursor_free(IntListCursor cursor) {
+    free(cursor);
+}
+
+IntListCursor intlist_cursor_new(IntList list) {
+    if (_intlist_not_exists(list)) return NULL;
+
+    IntListCursor new_cursor = (IntListCursor) malloc(sizeof (struct _intlistcursor));
+    if (!new_cursor) return NULL;
+
+    if (!_memmngr_register(new_cursor, (void (*)(void*)) _intlist_cursor_free)) {
+        free(new_cursor);
+        return NULL;
+    }
+
+    *new_cursor = (struct _intlistcursor) {.list = list, .node = list->head, .index = 0};
+    return new_cursor;
+}
+
+bool intlist_cursor_is_valid(const IntListCursor cursor) {
+    return cursor && cursor->node;
+}
+
+size_t intlist_cursor_index(const IntListCursor cursor) {
+    return cursor ? cursor->index : 0;
+}
+
+bool intlist_cursor_next(IntListCursor cursor) {
+    if (!intlist_cursor_is_valid(cursor)) return false;
+
+    cursor->node = cursor->node->next;
+    cursor->index++;
+    return cursor->node;
+}
+
+bool intlist_cursor_prev(IntListCursor cursor) {
+    if (!cursor) return false;
+
+    IntNode prev = cursor->node ? cursor->node->prev : cursor->list->tail;
+    if (!prev) return false;
+
+    cursor->node = prev;
+    cursor->index--;
+    return true;
+}
+
+bool intlist_cursor_seek(IntListCursor cursor, size_t index) {
+    if (!cursor || index > cursor->list->size) return false;
+
+    cursor->node = index < cursor->list->size ? _intlist_node_at(cursor->list, index) : NULL;
+    cursor->index = index;
+    return true;
+}
+
+bool intlist_cursor_get(const IntListCursor cursor, int* out) {
+    if (!intlist_cursor_is_valid(cursor) || !out) return false;
+    *out = cursor->node->value;
+    return true;
+}
+
+bool intlist_cursor_set(IntListCursor cursor, int value) {
+    if (!intlist_cursor_is_valid(cursor)) return false;
+    cursor->node->value = value;
+    return true;
+}
+
+bool intlist_cursor_insert(IntListCursor cursor, int value) {
+    if (!cursor || !_intlist_link_before(cursor->list, value, cursor->node)) return false;
+
+    cursor->index++;
+    return true;
+}
+
+bool intlist_cursor_remove(IntListCursor cursor) {
+    if (!intlist_cursor_is_valid(cursor)) return false;
+
+    IntNode next = cursor->node->next;
+    _intlist_unlink_node(cursor->list, cursor->node);
+    cursor->node = next;
+    return true;
 }
\ No newline at end of file
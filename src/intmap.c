@@ -19,6 +19,7 @@ struct _intmap {
     IntMapNode* table;
     uint32_t size;
     uint32_t capacity;
+    uint32_t resizes;
 };
 
 struct _intmapiter {
@@ -71,10 +72,9 @@ static uint32_t _intmap_hash(const char* key) {
 
 static uint32_t _intmap_get_index(uint32_t hash, uint32_t capacity) { return hash & (capacity - 1); }
 
-static IntMapNode _intmap_get_node_by_key(const IntMap map, const char* key) {
+static IntMapNode _intmap_get_node_by_hash(const IntMap map, const char* key, uint32_t hash) {
     if (intmap_is_empty(map) || !key) return NULL;
 
-    uint32_t hash = _intmap_hash(key);
     IntMapNode curr = map->table[_intmap_get_index(hash, map->capacity)];
     while (curr) {
         if (hash == curr->hash && strcmp(curr->key, key) == 0) return curr;
@@ -83,6 +83,10 @@ static IntMapNode _intmap_get_node_by_key(const IntMap map, const char* key) {
     return NULL;
 }
 
+static IntMapNode _intmap_get_node_by_key(const IntMap map, const char* key) {
+    return key ? _intmap_get_node_by_hash(map, key, _intmap_hash(key)) : NULL;
+}
+
 static void _intmap_transfer(const IntMap map, IntMapNode* new_table, uint32_t new_capacity) {
     for (uint32_t i = 0; i < map->capacity; i++) {
         for (IntMapNode curr = map->table[i], next; curr; curr = next) {
@@ -107,6 +111,7 @@ static bool _intmap_resize(IntMap map) {
     free(map->table);
     map->table = new_table;
     map->capacity = new_capacity;
+    map->resizes++;
     return true;
 }
 
@@ -140,7 +145,7 @@ IntMap intmap_new(void) {
         return NULL;
     }
 
-    *new_map = (struct _intmap) {.table = table, .size = 0, .capacity = INITIAL_CAPACITY};
+    *new_map = (struct _intmap) {.table = table, .size = 0, .capacity = INITIAL_CAPACITY, .resizes = 0};
     return new_map;
 }
 
@@ -157,10 +162,13 @@ void intmap_clear(IntMap map) {
     map->size = 0;
 }
 
-bool intmap_insert(IntMap map, const char* key, int value) {
+uint32_t intmap_hash_key(const char* key) {
+    return key ? _intmap_hash(key) : 0;
+}
+
+bool intmap_insert_hashed(IntMap map, const char* key, uint32_t hash, int value) {
     if (_intmap_not_exists(map) || !key) return false;
     
-    uint32_t hash = _intmap_hash(key);
     uint32_t index = _intmap_get_index(hash, map->capacity);
     
     for (IntMapNode curr = map->table[index]; curr; curr = curr->next) { 
@@ -183,28 +191,38 @@ bool intmap_insert(IntMap map, const char* key, int value) {
     return true;
 }
 
-bool intmap_get(const IntMap map, const char* key, int* out) {
+bool intmap_insert(IntMap map, const char* key, int value) {
+    return key && intmap_insert_hashed(map, key, _intmap_hash(key), value);
+}
+
+bool intmap_get_hashed(const IntMap map, const char* key, uint32_t hash, int* out) {
     if (!out) return false;
 
-    IntMapNode target = _intmap_get_node_by_key(map, key);
+    IntMapNode target = _intmap_get_node_by_hash(map, key, hash);
     if (!target) return false;
 
     *out = target->value;
     return true;
 }
 
+bool intmap_get(const IntMap map, const char* key, int* out) {
+    return key && intmap_get_hashed(map, key, _intmap_hash(key), out);
+}
+
 bool intmap_set(IntMap map, const char* key, int new_value) {
-    IntMapNode target = _intmap_get_node_by_key(map, key);
-    if (!target) return intmap_insert(map, key, new_value);
+    if (!key) return false;
+
+    uint32_t hash = _intmap_hash(key);
+    IntMapNode target = _intmap_get_node_by_hash(map, key, hash);
+    if (!target) return intmap_insert_hashed(map, key, hash, new_value);
 
     target->value = new_value;
     return true;
 }
 
-void intmap_remove(IntMap map, const char* key) {
+void intmap_remove_hashed(IntMap map, const char* key, uint32_t hash) {
     if (intmap_is_empty(map) || !key) return;
 
-    uint32_t hash = _intmap_hash(key);
     uint32_t index = _intmap_get_index(hash, map->capacity);
 
     for (IntMapNode curr = map->table[index], prev = NULL; curr; prev = curr, curr = curr->next) {
@@ -218,6 +236,10 @@ void intmap_remove(IntMap map, const char* key) {
     }
 }
 
+void intmap_remove(IntMap map, const char* key) {
+    if (key) intmap_remove_hashed(map, key, _intmap_hash(key));
+}
+
 bool intmap_has_key(const IntMap map, const char* key) { return _intmap_get_node_by_key(map, key); }
 
 char** intmap_keys(const IntMap map) {
@@ -270,7 +292,7 @@ bool intmap_equals(const IntMap map1, const IntMap map2) {
     for (uint32_t i = 0; i < map1->capacity; i++) {
         for (IntMapNode curr1 = map1->table[i]; curr1; curr1 = curr1->next) {
             int value2;
-            if (!intmap_get(map2, curr1->key, &value2) || value2 != curr1->value) return false;
+            if (!intmap_get_hashed(map2, curr1->key, curr1->hash, &value2) || value2 != curr1->value) return false;
         }
     }
     return true;
@@ -280,6 +302,26 @@ uint32_t intmap_size(const IntMap map) {
     return _intmap_not_exists(map) ? 0 : map->size;
 }
 
+bool intmap_stats(const IntMap map, IntMapStats* out) {
+    if (_intmap_not_exists(map) || !out) return false;
+
+    *out = (struct intmapstats) {.capacity = map->capacity, .size = map->size, .resize_count = map->resizes};
+    out->load_factor = (double) map->size / map->capacity;
+    out->bytes_used = sizeof (struct _intmap) + sizeof (IntMapNode) * map->capacity;
+
+    for (uint32_t i = 0; i < map->capacity; i++) {
+        uint32_t chain = 0;
+        for (IntMapNode curr = map->table[i]; curr; curr = curr->next, chain++) {
+            out->bytes_used += sizeof (struct _intmapnode) + strlen(curr->key) + 1;
+        }
+
+        out->chain_histogram[chain < INTMAP_STATS_HISTOGRAM_SIZE ? chain : INTMAP_STATS_HISTOGRAM_SIZE - 1]++;
+        if (chain > out->max_chain) out->max_chain = chain;
+    }
+    out->empty_bucket_ratio = (double) out->chain_histogram[0] / map->capacity;
+    return true;
+}
+
 static void _intmap_iter_free(IntMapIter iter) {
     if (iter) {
         for (int i = 0; i < iter->size; i++) free(iter->items[i].key);
@@ -0,0 +1,279 @@
+#include "queue/intmpmcqueue.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <limits.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "internal/memmngr.h"
+
+#define CACHE_LINE 64
+#define MIN_CAPACITY 2
+#define MAX_CAPACITY ((SIZE_MAX / sizeof (struct _intmpmcslot)) / 2 + 1)
+#define SPINS_BEFORE_YIELD 64
+#define SPINS_BEFORE_PARK 1024
+
+// A slot's sequence says whose turn it is: equal to a position, the slot is free for the producer claiming it;
+// one past it, the value is ready for the consumer claiming it, who then moves the sequence a whole lap ahead
+typedef struct _intmpmcslot {
+    atomic_size_t sequence;
+    int value;
+} IntMpmcSlot;
+
+// Blocked callers sleep on a futex word that the other side only bumps while someone is parked on it: enqueued
+// for consumers waiting for a value, dequeued for producers waiting for room
+struct _intmpmcqueue {
+    alignas(CACHE_LINE) atomic_size_t enqueue_pos;
+    alignas(CACHE_LINE) atomic_size_t dequeue_pos;
+    alignas(CACHE_LINE) IntMpmcSlot* slots;
+    size_t mask;
+    alignas(CACHE_LINE) atomic_uint enqueued;
+    atomic_uint dequeue_waiters;
+    atomic_uint dequeued;
+    atomic_uint enqueue_waiters;
+};
+
+static bool _intmpmcqueue_not_exists(const IntMpmcQueue queue) {
+    return !queue;
+}
+
+static void _intmpmcqueue_free(IntMpmcQueue queue) {
+    free(queue->slots);
+    free(queue);
+}
+
+IntMpmcQueue intmpmcqueue_new(size_t capacity) {
+    if (capacity == 0 || capacity > MAX_CAPACITY) return NULL;
+
+    size_t ring = MIN_CAPACITY;
+    while (ring < capacity) ring *= 2;
+
+    IntMpmcQueue new_queue = (IntMpmcQueue) aligned_alloc(CACHE_LINE, sizeof (struct _intmpmcqueue));
+    if (_intmpmcqueue_not_exists(new_queue)) return NULL;
+
+    IntMpmcSlot* slots = (IntMpmcSlot*) malloc(ring * sizeof (IntMpmcSlot));
+    if (!slots) {
+        free(new_queue);
+        return NULL;
+    }
+
+    if (!_memmngr_register(new_queue, (void (*)(void*)) _intmpmcqueue_free)) {
+        free(slots);
+        free(new_queue);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < ring; i++) atomic_init(&slots[i].sequence, i);
+    atomic_init(&new_queue->enqueue_pos, 0);
+    atomic_init(&new_queue->dequeue_pos, 0);
+    atomic_init(&new_queue->enqueued, 0);
+    atomic_init(&new_queue->dequeue_waiters, 0);
+    atomic_init(&new_queue->dequeued, 0);
+    atomic_init(&new_queue->enqueue_waiters, 0);
+    new_queue->slots = slots;
+    new_queue->mask = ring - 1;
+    return new_queue;
+}
+
+// Short spins cover a peer that is mid-copy on another core; yielding covers one that was preempted
+static void _intmpmcqueue_backoff(unsigned* spins) {
+    if (++*spins % SPINS_BEFORE_YIELD == 0) sched_yield();
+}
+
+// Registers a waiter and returns the word's value to sleep on. The fence pairs with the one in _intmpmcqueue_notify:
+// either the caller's next attempt sees the peer's progress, or the peer sees the waiter and bumps the word
+static unsigned _intmpmcqueue_prepare_park(atomic_uint* word, atomic_uint* waiters) {
+    unsigned seen = atomic_load_explicit(word, memory_order_relaxed);
+    atomic_fetch_add_explicit(waiters, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    return seen;
+}
+
+// Returns straight away if the word already moved past seen, so a bump between the last attempt and the sleep is not lost
+static void _intmpmcqueue_park(atomic_uint* word, atomic_uint* waiters, unsigned seen) {
+    syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, seen, NULL, NULL, 0);
+    atomic_fetch_sub_explicit(waiters, 1, memory_order_relaxed);
+}
+
+static void _intmpmcqueue_notify(atomic_uint* word, atomic_uint* waiters, int count) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiters, memory_order_relaxed) == 0) return;
+
+    atomic_fetch_add_explicit(word, 1, memory_order_relaxed);
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+// Waits for a slot claimed through a batch to reach the given sequence, its previous owner has already claimed it too
+static IntMpmcSlot* _intmpmcqueue_await(IntMpmcQueue queue, size_t pos, size_t sequence) {
+    IntMpmcSlot* slot = &queue->slots[pos & queue->mask];
+
+    unsigned spins = 0;
+    while (atomic_load_explicit(&slot->sequence, memory_order_acquire) != sequence) _intmpmcqueue_backoff(&spins);
+    return slot;
+}
+
+bool intmpmcqueue_enqueue(IntMpmcQueue queue, int value) {
+    if (_intmpmcqueue_not_exists(queue)) return false;
+
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    IntMpmcSlot* slot;
+    while (true) {
+        slot = &queue->slots[pos & queue->mask];
+        intptr_t diff = (intptr_t) atomic_load_explicit(&slot->sequence, memory_order_acquire) - (intptr_t) pos;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    slot->value = value;
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+    _intmpmcqueue_notify(&queue->enqueued, &queue->dequeue_waiters, 1);
+    return true;
+}
+
+bool intmpmcqueue_dequeue(IntMpmcQueue queue, int* out) {
+    if (_intmpmcqueue_not_exists(queue)) return false;
+
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    IntMpmcSlot* slot;
+    while (true) {
+        slot = &queue->slots[pos & queue->mask];
+        intptr_t diff = (intptr_t) atomic_load_explicit(&slot->sequence, memory_order_acquire) - (intptr_t) (pos + 1);
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    if (out) *out = slot->value;
+    atomic_store_explicit(&slot->sequence, pos + queue->mask + 1, memory_order_release);
+    _intmpmcqueue_notify(&queue->dequeued, &queue->enqueue_waiters, 1);
+    return true;
+}
+
+// The waits spin and yield for a while, since the other side usually catches up quickly, then sleep until it moves
+bool intmpmcqueue_enqueue_wait(IntMpmcQueue queue, int value) {
+    if (_intmpmcqueue_not_exists(queue)) return false;
+
+    for (unsigned spins = 0; !intmpmcqueue_enqueue(queue, value); ) {
+        if (spins < SPINS_BEFORE_PARK) {
+            _intmpmcqueue_backoff(&spins);
+            continue;
+        }
+
+        unsigned seen = _intmpmcqueue_prepare_park(&queue->dequeued, &queue->enqueue_waiters);
+        if (intmpmcqueue_enqueue(queue, value)) {
+            atomic_fetch_sub_explicit(&queue->enqueue_waiters, 1, memory_order_relaxed);
+            break;
+        }
+        _intmpmcqueue_park(&queue->dequeued, &queue->enqueue_waiters, seen);
+    }
+    return true;
+}
+
+bool intmpmcqueue_dequeue_wait(IntMpmcQueue queue, int* out) {
+    if (_intmpmcqueue_not_exists(queue)) return false;
+
+    for (unsigned spins = 0; !intmpmcqueue_dequeue(queue, out); ) {
+        if (spins < SPINS_BEFORE_PARK) {
+            _intmpmcqueue_backoff(&spins);
+            continue;
+        }
+
+        unsigned seen = _intmpmcqueue_prepare_park(&queue->enqueued, &queue->dequeue_waiters);
+        if (intmpmcqueue_dequeue(queue, out)) {
+            atomic_fetch_sub_explicit(&queue->dequeue_waiters, 1, memory_order_relaxed);
+            break;
+        }
+        _intmpmcqueue_park(&queue->enqueued, &queue->dequeue_waiters, seen);
+    }
+    return true;
+}
+
+// Batches claim a whole run of positions with one CAS, sized from the other end's counter: every slot in the run
+// then already has a claimed previous owner, so each slot is at most a short wait away from being ready. That wait,
+// in _intmpmcqueue_await, spins and yields until the owner finishes, so a batch call returns no sooner than every
+// peer holding one of its slots, even a preempted one; it never waits for the queue itself to fill or drain
+size_t intmpmcqueue_enqueue_n(IntMpmcQueue queue, const int* arr, size_t size) {
+    if (_intmpmcqueue_not_exists(queue) || !arr || size == 0) return 0;
+
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    size_t claimed;
+    while (true) {
+        size_t head = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+        if ((intptr_t) (pos - head) < 0) {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+            continue;
+        }
+
+        size_t room = queue->mask + 1 - (pos - head);
+        claimed = size < room ? size : room;
+        if (claimed == 0) return 0;
+
+        if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + claimed, memory_order_relaxed, memory_order_relaxed)) break;
+    }
+
+    for (size_t i = 0; i < claimed; i++) {
+        IntMpmcSlot* slot = _intmpmcqueue_await(queue, pos + i, pos + i);
+        slot->value = arr[i];
+        atomic_store_explicit(&slot->sequence, pos + i + 1, memory_order_release);
+    }
+    _intmpmcqueue_notify(&queue->enqueued, &queue->dequeue_waiters, INT_MAX);
+    return claimed;
+}
+
+size_t intmpmcqueue_dequeue_n(IntMpmcQueue queue, int* out, size_t size) {
+    if (_intmpmcqueue_not_exists(queue) || !out || size == 0) return 0;
+
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    size_t claimed;
+    while (true) {
+        size_t tail = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+        size_t ready = tail - pos;
+        claimed = size < ready ? size : ready;
+        if (claimed == 0) return 0;
+
+        if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + claimed, memory_order_relaxed, memory_order_relaxed)) break;
+    }
+
+    for (size_t i = 0; i < claimed; i++) {
+        IntMpmcSlot* slot = _intmpmcqueue_await(queue, pos + i, pos + i + 1);
+        out[i] = slot->value;
+        atomic_store_explicit(&slot->sequence, pos + i + queue->mask + 1, memory_order_release);
+    }
+    _intmpmcqueue_notify(&queue->dequeued, &queue->enqueue_waiters, INT_MAX);
+    return claimed;
+}
+
+// Counts claimed positions, so values still being written or read are included; a snapshot under concurrent use
+size_t intmpmcqueue_size(const IntMpmcQueue queue) {
+    if (_intmpmcqueue_not_exists(queue)) return 0;
+
+    size_t head = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+    return tail - head;
+}
+
+bool intmpmcqueue_is_empty(const IntMpmcQueue queue) {
+    return intmpmcqueue_size(queue) == 0;
+}
+
+bool intmpmcqueue_is_full(const IntMpmcQueue queue) {
+    return !_intmpmcqueue_not_exists(queue) && intmpmcqueue_size(queue) >= queue->mask + 1;
+}
+
+size_t intmpmcqueue_capacity(const IntMpmcQueue queue) {
+    return _intmpmcqueue_not_exists(queue) ? 0 : queue->mask + 1;
+}
\ No newline at end of file
@@ -1,19 +1,25 @@
 #include "queue/intqueue.h"
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include "linkedlist/intlist.h"
 #include "stack/intstack.h"
+#include "queue/intdeque.h"
 #include "internal/memmngr.h"
+#include "internal/visit.h"
+#include "internal/fill.h"
 
+#define INITIAL_CAPACITY 8
+#define GROWTH_FACTOR 2
+#define MAX_CAPACITY ((SIZE_MAX / sizeof (int)) / 2 + 1)
 
-typedef struct _intnode {
-    int value;
-    struct _intnode* next;
-} *IntNode;
-
+// Values sit in a ring of power-of-two capacity starting at head, so wrapping is a mask; a non-zero limit caps the size
 struct _intqueue {
-    IntNode front;
-    IntNode rear;
+    int* data;
+    size_t capacity;
+    size_t head;
     size_t size;
+    size_t limit;
 };
 
 static bool _intqueue_not_exists(const IntQueue queue) {
@@ -21,20 +27,54 @@ static bool _intqueue_not_exists(const IntQueue queue) {
 }
 
 bool intqueue_is_empty(const IntQueue queue) {
-    return _intqueue_not_exists(queue) || !queue->front;
+    return _intqueue_not_exists(queue) || queue->size == 0;
 }
 
-static IntNode _intqueue_create_node(int value, IntNode next) {
-    IntNode new_node = (IntNode) malloc(sizeof (struct _intnode));
-    if (!new_node) return NULL;
+static void _intqueue_free(IntQueue queue) {
+    free(queue->data);
+    free(queue);
+}
 
-    *new_node = (struct _intnode) {.value = value, .next = next};
-    return new_node;
+static size_t _intqueue_slot(const IntQueue queue, size_t offset) {
+    return (queue->head + offset) & (queue->capacity - 1);
 }
 
-static void _intqueue_free(IntQueue queue) {
-    intqueue_clear(queue);
-    free(queue);
+static bool _intqueue_realloc(IntQueue queue, size_t new_capacity) {
+    int* new_data = (int*) realloc(queue->data, sizeof (int) * new_capacity);
+    if (!new_data) return false;
+
+    // The part that wrapped around to the start is moved right after the old end, which at least doubling leaves room for
+    size_t wrapped = queue->head + queue->size > queue->capacity ? queue->head + queue->size - queue->capacity : 0;
+    memcpy(new_data + queue->capacity, new_data, sizeof (int) * wrapped);
+
+    queue->data = new_data;
+    queue->capacity = new_capacity;
+    return true;
+}
+
+static bool _intqueue_grow(IntQueue queue, size_t extra) {
+    if (extra > MAX_CAPACITY - queue->size) return false;
+    if (queue->limit && extra > queue->limit - queue->size) return false;
+
+    size_t required = queue->size + extra;
+    if (required <= queue->capacity) return true;
+
+    size_t new_capacity = queue->capacity ? queue->capacity * GROWTH_FACTOR : INITIAL_CAPACITY;
+    while (new_capacity < required) new_capacity *= GROWTH_FACTOR;
+    return _intqueue_realloc(queue, new_capacity);
+}
+
+// How many of the size values starting at offset lie before the end of the ring; the rest continue from its start
+static size_t _intqueue_first_run(const IntQueue queue, size_t offset, size_t size) {
+    size_t start = _intqueue_slot(queue, offset);
+    return queue->capacity - start < size ? queue->capacity - start : size;
+}
+
+// Copies size values starting at offset out of the ring, in at most two runs
+static void _intqueue_copy_out(const IntQueue queue, size_t offset, int* arr, size_t size) {
+    size_t first = _intqueue_first_run(queue, offset, size);
+    memcpy(arr, queue->data + _intqueue_slot(queue, offset), sizeof (int) * first);
+    memcpy(arr + first, queue->data, sizeof (int) * (size - first));
 }
 
 IntQueue intqueue_new(void) {
@@ -46,58 +86,129 @@ IntQueue intqueue_new(void) {
         return NULL;
     }
 
-    *new_queue = (struct _intqueue) {.front = NULL, .rear = NULL, .size = 0};
+    *new_queue = (struct _intqueue) {.data = NULL, .capacity = 0, .head = 0, .size = 0, .limit = 0};
     return new_queue;
 }
 
-void intqueue_clear(IntQueue queue) {
-    if (intqueue_is_empty(queue)) return;
+// The whole ring is allocated up front, so a bounded queue never reallocates
+IntQueue intqueue_new_bounded(size_t capacity) {
+    if (capacity == 0 || capacity > MAX_CAPACITY) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (_intqueue_not_exists(new_queue)) return NULL;
+
+    size_t ring = INITIAL_CAPACITY;
+    while (ring < capacity) ring *= GROWTH_FACTOR;
 
-    for (IntNode curr = queue->front, next; curr; curr = next) {
-        next = curr->next;
-        free(curr);
+    if (!_intqueue_realloc(new_queue, ring)) {
+        _memmngr_rollback();
+        return NULL;
     }
+    new_queue->limit = capacity;
+    return new_queue;
+}
 
-    queue->front = queue->rear = NULL;
+void intqueue_clear(IntQueue queue) {
+    if (_intqueue_not_exists(queue)) return;
+
+    queue->head = 0;
     queue->size = 0;
 }
 
-bool intqueue_enqueue(IntQueue queue, int value) {
-    if (_intqueue_not_exists(queue)) return false;
+int* _intqueue_fill(IntQueue queue, size_t count) {
+    if (!_intqueue_grow(queue, count)) return NULL;
 
-    IntNode new_node = _intqueue_create_node(value, NULL);
-    if (!new_node) return false;
+    queue->head = 0;
+    queue->size = count;
+    return queue->data;
+}
+
+bool _intqueue_adopt(IntQueue queue, int* data, size_t capacity, size_t size) {
+    if (size > MAX_CAPACITY) return false;
 
-    IntNode rear = queue->rear;
-    queue->rear = new_node;
-    if (!rear)  queue->front = new_node;
-    else        rear->next = new_node;
+    size_t ring = 1;
+    while (ring <= capacity / 2) ring *= 2;
+    if (ring < size) {
+        ring *= 2;
 
+        int* new_data = (int*) realloc(data, sizeof (int) * ring);
+        if (!new_data) return false;
+        data = new_data;
+    }
+
+    free(queue->data);
+    queue->data = data;
+    queue->capacity = ring;
+    queue->head = 0;
+    queue->size = size;
+    return true;
+}
+
+bool intqueue_enqueue(IntQueue queue, int value) {
+    if (_intqueue_not_exists(queue) || !_intqueue_grow(queue, 1)) return false;
+
+    queue->data[_intqueue_slot(queue, queue->size)] = value;
     queue->size++;
     return true;
 }
 
-bool intqueue_dequeue(IntQueue queue, int* out) {
-    if (intqueue_is_empty(queue)) return false;
+bool intqueue_enqueue_n(IntQueue queue, const int* arr, size_t size) {
+    if (_intqueue_not_exists(queue) || (!arr && size > 0)) return false;
+    if (size == 0) return true;
+    if (!_intqueue_grow(queue, size)) return false;
 
-    IntNode front = queue->front;
-    if (out) *out = front->value;
+    size_t start = _intqueue_slot(queue, queue->size);
+    size_t first = queue->capacity - start < size ? queue->capacity - start : size;
+    memcpy(queue->data + start, arr, sizeof (int) * first);
+    memcpy(queue->data, arr + first, sizeof (int) * (size - first));
 
-    queue->front = front->next;
-    if (!queue->front) queue->rear = NULL;
+    queue->size += size;
+    return true;
+}
 
-    free(front);
+bool intqueue_dequeue(IntQueue queue, int* out) {
+    if (intqueue_is_empty(queue)) return false;
 
+    if (out) *out = queue->data[queue->head];
+    queue->head = _intqueue_slot(queue, 1);
     queue->size--;
     return true;
 }
 
+// Moves up to size values from the front into out and returns how many were moved
+size_t intqueue_dequeue_n(IntQueue queue, int* out, size_t size) {
+    if (intqueue_is_empty(queue) || !out) return 0;
+    if (size > queue->size) size = queue->size;
+
+    size_t first = queue->capacity - queue->head < size ? queue->capacity - queue->head : size;
+    memcpy(out, queue->data + queue->head, sizeof (int) * first);
+    memcpy(out + first, queue->data, sizeof (int) * (size - first));
+
+    queue->head = _intqueue_slot(queue, size);
+    queue->size -= size;
+    return size;
+}
+
 bool intqueue_peek(const IntQueue queue, int* out) {
     if (intqueue_is_empty(queue) || !out) return false;
-    *out = queue->front->value;
+    *out = queue->data[queue->head];
     return true;
 }
 
+bool intqueue_is_full(const IntQueue queue) {
+    return !_intqueue_not_exists(queue) && queue->limit && queue->size == queue->limit;
+}
+
+size_t intqueue_capacity(const IntQueue queue) {
+    return _intqueue_not_exists(queue) ? 0 : queue->limit ? queue->limit : queue->capacity;
+}
+
+void _intqueue_visit(const IntQueue queue, IntVisitor visit_func, void* ctx) {
+    if (_intqueue_not_exists(queue)) return;
+
+    for (size_t i = 0; i < queue->size && visit_func(queue->data[_intqueue_slot(queue, i)], ctx); i++);
+}
+
 size_t intqueue_size(IntQueue queue) {
     return _intqueue_not_exists(queue) ? 0 : queue->size;
 }
@@ -106,13 +217,12 @@ IntList intqueue_to_list(const IntQueue queue) {
     if (_intqueue_not_exists(queue)) return NULL;
 
     IntList new_list = intlist_new();
-    if (!new_list) return NULL;
+    if (!new_list || intqueue_is_empty(queue)) return new_list;
 
-    for (IntNode curr = queue->front; curr; curr = curr->next) {
-        if (!intlist_push(new_list, curr->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
+    size_t first = _intqueue_first_run(queue, 0, queue->size);
+    if (!intlist_push_n(new_list, queue->data + queue->head, first) || !intlist_push_n(new_list, queue->data, queue->size - first)) {
+        _memmngr_rollback();
+        return NULL;
     }
     return new_list;
 }
@@ -121,13 +231,80 @@ IntStack intqueue_to_stack(const IntQueue queue) {
     if (_intqueue_not_exists(queue)) return NULL;
 
     IntStack new_stack = intstack_new();
-    if (!new_stack) return NULL;
+    if (!new_stack || intqueue_is_empty(queue)) return new_stack;
 
-    for (IntNode curr = queue->front; curr; curr = curr->next) {
-        if (!intstack_push(new_stack, curr->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
+    int* slots = _intstack_fill(new_stack, queue->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
     }
+
+    _intqueue_copy_out(queue, 0, slots, queue->size);
+    return new_stack;
+}
+
+IntDeque intqueue_to_deque(const IntQueue queue) {
+    if (_intqueue_not_exists(queue)) return NULL;
+
+    IntDeque new_deque = intdeque_new();
+    if (!new_deque || intqueue_is_empty(queue)) return new_deque;
+
+    size_t first = _intqueue_first_run(queue, 0, queue->size);
+    if (!intdeque_push_back_n(new_deque, queue->data + queue->head, first) || !intdeque_push_back_n(new_deque, queue->data, queue->size - first)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_deque;
+}
+
+static void _intqueue_disown(IntQueue queue) {
+    queue->data = NULL;
+    queue->capacity = 0;
+    queue->head = 0;
+    queue->size = 0;
+}
+
+static void _intqueue_reverse(int* data, size_t size) {
+    for (size_t i = 0, j = size - 1; i < size / 2; i++, j--) {
+        int temp = data[i];
+        data[i] = data[j];
+        data[j] = temp;
+    }
+}
+
+// Moves the front to index 0 in place: one memmove when the values do not wrap, otherwise the whole ring is rotated
+// left by head with three reversals
+static void _intqueue_linearize(IntQueue queue) {
+    if (queue->head + queue->size <= queue->capacity) {
+        memmove(queue->data, queue->data + queue->head, sizeof (int) * queue->size);
+    } else {
+        _intqueue_reverse(queue->data, queue->head);
+        _intqueue_reverse(queue->data + queue->head, queue->capacity - queue->head);
+        _intqueue_reverse(queue->data, queue->capacity);
+    }
+    queue->head = 0;
+}
+
+// Copy and free rather than a move: nodes cannot reuse the ring, so the values are copied once into a freshly allocated
+// list and the ring is released
+IntList intqueue_into_list(IntQueue queue) {
+    IntList new_list = intqueue_to_list(queue);
+    if (new_list) {
+        free(queue->data);
+        _intqueue_disown(queue);
+    }
+    return new_list;
+}
+
+// Once linearized, the ring already is the stack bottom to top, so it becomes the stack's array without a copy
+IntStack intqueue_into_stack(IntQueue queue) {
+    if (_intqueue_not_exists(queue)) return NULL;
+
+    IntStack new_stack = intstack_new();
+    if (!new_stack || intqueue_is_empty(queue)) return new_stack;
+
+    _intqueue_linearize(queue);
+    _intstack_adopt(new_stack, queue->data, queue->capacity, queue->size);
+    _intqueue_disown(queue);
     return new_stack;
 }
\ No newline at end of file
@@ -0,0 +1,556 @@
+#include "linkedlist/intskiplist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+#include "internal/fill.h"
+#include "internal/textio.h"
+
+#define MAX_LEVEL 16
+#define INITIAL_SEED 2463534242u
+#define COPY_BATCH 256
+
+// Each link records how many elements it skips, so positions are found by summing spans along the search path
+typedef struct _intskiplink {
+    struct _intskipnode* next;
+    size_t span;
+} IntSkipLink;
+
+typedef struct _intskipnode {
+    int value;
+    size_t level;
+    struct _intskipnode* prev;
+    IntSkipLink links[];
+} *IntSkipNode;
+
+// The header is a sentinel at position 0, so the element at index i sits at position i + 1
+struct _intskiplist {
+    IntSkipNode header;
+    IntSkipNode tail;
+    size_t size;
+    size_t level;
+    uint32_t seed;
+};
+
+static atomic_uint _intskiplist_created = 0;
+
+static bool _intskiplist_not_exists(const IntSkipList list) {
+    return !list;
+}
+
+bool intskiplist_is_empty(const IntSkipList list) {
+    return _intskiplist_not_exists(list) || list->size == 0;
+}
+
+// Draws a level with P(level > k) = 1/4^k from the list's own xorshift generator, so lists never share RNG state
+static size_t _intskiplist_random_level(IntSkipList list) {
+    uint32_t x = list->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    list->seed = x;
+
+    size_t level = 1;
+    while (level < MAX_LEVEL && (x & 3) == 0) {
+        level++;
+        x >>= 2;
+    }
+    return level;
+}
+
+// Runs the creation number through the murmur3 finalizer, so lists made one after another draw unrelated sequences
+static uint32_t _intskiplist_new_seed(void) {
+    uint32_t x = (uint32_t) atomic_fetch_add_explicit(&_intskiplist_created, 1, memory_order_relaxed) + INITIAL_SEED;
+    x ^= x >> 16;
+    x *= 0x85ebca6bu;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+
+    // Zero is the one state xorshift never leaves
+    return x ? x : INITIAL_SEED;
+}
+
+static IntSkipNode _intskiplist_create_node(int value, size_t level) {
+    IntSkipNode new_node = (IntSkipNode) malloc(sizeof (struct _intskipnode) + sizeof (IntSkipLink) * level);
+    if (!new_node) return NULL;
+
+    new_node->value = value;
+    new_node->level = level;
+    new_node->prev = NULL;
+    for (size_t i = 0; i < level; i++) new_node->links[i] = (IntSkipLink) {.next = NULL, .span = 0};
+    return new_node;
+}
+
+static void _intskiplist_free(IntSkipList list) {
+    intskiplist_clear(list);
+    free(list->header);
+    free(list);
+}
+
+static IntSkipNode _intskiplist_node_at(const IntSkipList list, size_t index) {
+    IntSkipNode x = list->header;
+    size_t traversed = 0;
+    for (size_t i = list->level; i-- > 0; ) {
+        while (x->links[i].next && traversed + x->links[i].span <= index + 1) {
+            traversed += x->links[i].span;
+            x = x->links[i].next;
+        }
+        if (traversed == index + 1) break;
+    }
+    return x;
+}
+
+// Collects, for every level, the last node placed before index together with its position
+static void _intskiplist_find_preds(const IntSkipList list, size_t index, IntSkipNode* update, size_t* rank) {
+    IntSkipNode x = list->header;
+    size_t traversed = 0;
+    for (size_t i = list->level; i-- > 0; ) {
+        while (x->links[i].next && traversed + x->links[i].span <= index) {
+            traversed += x->links[i].span;
+            x = x->links[i].next;
+        }
+        update[i] = x;
+        rank[i] = traversed;
+    }
+}
+
+static bool _intskiplist_insert(IntSkipList list, int value, size_t index) {
+    IntSkipNode update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    _intskiplist_find_preds(list, index, update, rank);
+
+    size_t level = _intskiplist_random_level(list);
+    IntSkipNode new_node = _intskiplist_create_node(value, level);
+    if (!new_node) return false;
+
+    if (level > list->level) {
+        for (size_t i = list->level; i < level; i++) {
+            update[i] = list->header;
+            rank[i] = 0;
+            list->header->links[i] = (IntSkipLink) {.next = NULL, .span = list->size};
+        }
+        list->level = level;
+    }
+
+    for (size_t i = 0; i < level; i++) {
+        IntSkipLink* pred_link = &update[i]->links[i];
+        new_node->links[i].next = pred_link->next;
+        new_node->links[i].span = pred_link->span - (index - rank[i]);
+        pred_link->next = new_node;
+        pred_link->span = index - rank[i] + 1;
+    }
+    for (size_t i = level; i < list->level; i++) update[i]->links[i].span++;
+
+    new_node->prev = update[0] == list->header ? NULL : update[0];
+    if (new_node->links[0].next)    new_node->links[0].next->prev = new_node;
+    else                            list->tail = new_node;
+
+    list->size++;
+    return true;
+}
+
+static void _intskiplist_remove(IntSkipList list, size_t index) {
+    IntSkipNode update[MAX_LEVEL] = {NULL};
+    size_t rank[MAX_LEVEL];
+    _intskiplist_find_preds(list, index, update, rank);
+
+    IntSkipNode target = update[0]->links[0].next;
+    for (size_t i = 0; i < list->level; i++) {
+        IntSkipLink* pred_link = &update[i]->links[i];
+        if (pred_link->next == target) {
+            pred_link->span += target->links[i].span - 1;
+            pred_link->next = target->links[i].next;
+        } else {
+            pred_link->span--;
+        }
+    }
+
+    if (target->links[0].next)  target->links[0].next->prev = target->prev;
+    else                        list->tail = target->prev;
+
+    while (list->level > 1 && !list->header->links[list->level - 1].next) list->level--;
+
+    free(target);
+    list->size--;
+}
+
+// Appends at the bottom level only; callers restore the upper levels with _intskiplist_relink afterwards
+static bool _intskiplist_append_unlinked(IntSkipList list, int value) {
+    IntSkipNode new_node = _intskiplist_create_node(value, _intskiplist_random_level(list));
+    if (!new_node) return false;
+
+    IntSkipNode last = list->tail ? list->tail : list->header;
+    last->links[0].next = new_node;
+    new_node->prev = list->tail;
+    list->tail = new_node;
+    list->size++;
+    return true;
+}
+
+// Rebuilds every express lane, span and back link from the bottom level order in a single O(n) pass
+static void _intskiplist_relink(IntSkipList list) {
+    IntSkipNode last[MAX_LEVEL];
+    size_t last_rank[MAX_LEVEL];
+    for (size_t i = 0; i < MAX_LEVEL; i++) {
+        last[i] = list->header;
+        last_rank[i] = 0;
+    }
+
+    size_t rank = 0, level = 1;
+    IntSkipNode prev = NULL;
+    for (IntSkipNode curr = list->header->links[0].next; curr; prev = curr, curr = curr->links[0].next) {
+        rank++;
+        curr->prev = prev;
+        for (size_t i = 0; i < curr->level; i++) {
+            last[i]->links[i] = (IntSkipLink) {.next = curr, .span = rank - last_rank[i]};
+            last[i] = curr;
+            last_rank[i] = rank;
+        }
+        if (curr->level > level) level = curr->level;
+    }
+
+    for (size_t i = 0; i < MAX_LEVEL; i++) last[i]->links[i] = (IntSkipLink) {.next = NULL, .span = list->size - last_rank[i]};
+    list->tail = prev;
+    list->level = level;
+}
+
+IntSkipList intskiplist_new(void) {
+    IntSkipList new_list = (IntSkipList) malloc(sizeof (struct _intskiplist));
+    if (_intskiplist_not_exists(new_list)) return NULL;
+
+    IntSkipNode header = _intskiplist_create_node(0, MAX_LEVEL);
+    if (!header) {
+        free(new_list);
+        return NULL;
+    }
+
+    if (!_memmngr_register(new_list, (void (*)(void*)) _intskiplist_free)) {
+        free(header);
+        free(new_list);
+        return NULL;
+    }
+
+    *new_list = (struct _intskiplist) {.header = header, .tail = NULL, .size = 0, .level = 1, .seed = _intskiplist_new_seed()};
+    return new_list;
+}
+
+void intskiplist_clear(IntSkipList list) {
+    if (_intskiplist_not_exists(list)) return;
+
+    for (IntSkipNode curr = list->header->links[0].next, next; curr; curr = next) {
+        next = curr->links[0].next;
+        free(curr);
+    }
+
+    for (size_t i = 0; i < MAX_LEVEL; i++) list->header->links[i] = (IntSkipLink) {.next = NULL, .span = 0};
+    list->tail = NULL;
+    list->size = 0;
+    list->level = 1;
+}
+
+bool intskiplist_push_front(IntSkipList list, int value) {
+    return !_intskiplist_not_exists(list) && _intskiplist_insert(list, value, 0);
+}
+
+bool intskiplist_push(IntSkipList list, int value) {
+    return !_intskiplist_not_exists(list) && _intskiplist_insert(list, value, list->size);
+}
+
+bool intskiplist_push_at(IntSkipList list, int value, size_t index) {
+    return !_intskiplist_not_exists(list) && index <= list->size && _intskiplist_insert(list, value, index);
+}
+
+void intskiplist_pop_front(IntSkipList list) {
+    if (intskiplist_is_empty(list)) return;
+    _intskiplist_remove(list, 0);
+}
+
+void intskiplist_pop(IntSkipList list) {
+    if (intskiplist_is_empty(list)) return;
+    _intskiplist_remove(list, list->size - 1);
+}
+
+void intskiplist_pop_at(IntSkipList list, size_t index) {
+    if (intskiplist_is_empty(list) || index >= list->size) return;
+    _intskiplist_remove(list, index);
+}
+
+size_t intskiplist_size(const IntSkipList list) {
+    return _intskiplist_not_exists(list) ? 0 : list->size;
+}
+
+bool intskiplist_front(const IntSkipList list, int* out) {
+    if (intskiplist_is_empty(list) || !out) return false;
+    *out = list->header->links[0].next->value;
+    return true;
+}
+
+bool intskiplist_get_at(const IntSkipList list, size_t index, int* out) {
+    if (intskiplist_is_empty(list) || !out || index >= list->size) return false;
+    *out = _intskiplist_node_at(list, index)->value;
+    return true;
+}
+
+bool intskiplist_set_at(IntSkipList list, size_t index, int value) {
+    if (intskiplist_is_empty(list) || index >= list->size) return false;
+    _intskiplist_node_at(list, index)->value = value;
+    return true;
+}
+
+bool intskiplist_back(const IntSkipList list, int* out) {
+    if (intskiplist_is_empty(list) || !out) return false;
+    *out = list->tail->value;
+    return true;
+}
+
+int intskiplist_index(const IntSkipList list, int target) {
+    if (_intskiplist_not_exists(list)) return -1;
+
+    IntSkipNode curr = list->header->links[0].next;
+    for (size_t i = 0; curr; i++, curr = curr->links[0].next) {
+        if (curr->value == target) return i;
+    }
+    return -1;
+}
+
+size_t intskiplist_count(const IntSkipList list, int target) {
+    if (_intskiplist_not_exists(list)) return 0;
+
+    size_t freq = 0;
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) {
+        if (curr->value == target) freq++;
+    }
+    return freq;
+}
+
+bool intskiplist_contains(const IntSkipList list, int target) {
+    if (_intskiplist_not_exists(list)) return false;
+
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) if (curr->value == target) return true;
+    return false;
+}
+
+bool intskiplist_equals(const IntSkipList list1, const IntSkipList list2) {
+    if (_intskiplist_not_exists(list1) || _intskiplist_not_exists(list2) || list1->size != list2->size) return false;
+
+    for (IntSkipNode curr1 = list1->header->links[0].next, curr2 = list2->header->links[0].next; curr1 && curr2; curr1 = curr1->links[0].next, curr2 = curr2->links[0].next) {
+        if (curr1->value != curr2->value) return false;
+    }
+    return true;
+}
+
+void intskiplist_reverse(IntSkipList list) {
+    if (_intskiplist_not_exists(list) || list->size < 2) return;
+
+    IntSkipNode head = list->header->links[0].next;
+    for (IntSkipNode curr = head, next; curr; curr = next) {
+        next = curr->links[0].next;
+        curr->links[0].next = curr->prev;
+    }
+    list->header->links[0].next = list->tail;
+
+    _intskiplist_relink(list);
+}
+
+IntSkipList intskiplist_from_array(int* arr, size_t size) {
+    if (!arr || size == 0) return NULL;
+
+    IntSkipList new_list = intskiplist_new();
+    if (_intskiplist_not_exists(new_list)) return NULL;
+
+    for (size_t i = 0; i < size; i++) {
+        if (!_intskiplist_append_unlinked(new_list, arr[i])) {
+            _memmngr_rollback();
+            return NULL;
+        }
+    }
+    _intskiplist_relink(new_list);
+    return new_list;
+}
+
+IntSkipList intskiplist_copy(const IntSkipList list) {
+    return intskiplist_map(list, NULL);
+}
+
+IntSkipList intskiplist_map(const IntSkipList list, int (*callback_func)(int value)) {
+    if (_intskiplist_not_exists(list)) return NULL;
+
+    IntSkipList new_list = intskiplist_new();
+    if (_intskiplist_not_exists(new_list)) return NULL;
+
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) {
+        if (!_intskiplist_append_unlinked(new_list, callback_func ? callback_func(curr->value) : curr->value)) {
+            _memmngr_rollback();
+            return NULL;
+        }
+    }
+    _intskiplist_relink(new_list);
+    return new_list;
+}
+
+IntSkipList intskiplist_filter(const IntSkipList list, bool (*predicate_func)(int value)) {
+    if (_intskiplist_not_exists(list)) return NULL;
+    if (!predicate_func) return intskiplist_copy(list);
+
+    IntSkipList new_list = intskiplist_new();
+    if (_intskiplist_not_exists(new_list)) return NULL;
+
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) {
+        if (predicate_func(curr->value)) {
+            if (!_intskiplist_append_unlinked(new_list, curr->value)) {
+                _memmngr_rollback();
+                return NULL;
+            }
+        }
+    }
+    _intskiplist_relink(new_list);
+    return new_list;
+}
+
+IntSkipList intskiplist_zip(const IntSkipList list1, const IntSkipList list2) {
+    if (_intskiplist_not_exists(list1) || _intskiplist_not_exists(list2)) return NULL;
+
+    IntSkipList new_list = intskiplist_new();
+    if (_intskiplist_not_exists(new_list)) return NULL;
+
+    for (IntSkipNode curr1 = list1->header->links[0].next, curr2 = list2->header->links[0].next; curr1 && curr2; curr1 = curr1->links[0].next, curr2 = curr2->links[0].next) {
+        if (!_intskiplist_append_unlinked(new_list, curr1->value) || !_intskiplist_append_unlinked(new_list, curr2->value)) {
+            _memmngr_rollback();
+            return NULL;
+        }
+    }
+    _intskiplist_relink(new_list);
+    return new_list;
+}
+
+int* intskiplist_to_array(const IntSkipList list) {
+    if (intskiplist_is_empty(list)) return NULL;
+
+    int* arr = (int*) malloc(sizeof (int) * list->size);
+    if (!arr) return NULL;
+
+    if (!_memmngr_register(arr, free)) {
+        free(arr);
+        return NULL;
+    }
+
+    IntSkipNode curr = list->header->links[0].next;
+    for (size_t i = 0; i < list->size; i++, curr = curr->links[0].next) arr[i] = curr->value;
+    return arr;
+}
+
+static void _intskiplist_copy_out(const IntSkipList list, int* arr) {
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) *arr++ = curr->value;
+}
+
+// Nodes are not contiguous, so values are gathered into a small on-stack batch and each batch appended in one call
+IntList intskiplist_to_list(const IntSkipList list) {
+    if (_intskiplist_not_exists(list)) return NULL;
+
+    IntList new_list = intlist_new();
+    if (!new_list) return NULL;
+
+    int batch[COPY_BATCH];
+    size_t count = 0;
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) {
+        batch[count++] = curr->value;
+        if (count < COPY_BATCH && curr->links[0].next) continue;
+
+        if (!intlist_push_n(new_list, batch, count)) {
+            _memmngr_rollback();
+            return NULL;
+        }
+        count = 0;
+    }
+    return new_list;
+}
+
+IntStack intskiplist_to_stack(const IntSkipList list) {
+    if (_intskiplist_not_exists(list)) return NULL;
+
+    IntStack new_stack = intstack_new();
+    if (!new_stack || intskiplist_is_empty(list)) return new_stack;
+
+    int* slots = _intstack_fill(new_stack, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intskiplist_copy_out(list, slots);
+    return new_stack;
+}
+
+IntQueue intskiplist_to_queue(const IntSkipList list) {
+    if (_intskiplist_not_exists(list)) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (!new_queue || intskiplist_is_empty(list)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, list->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intskiplist_copy_out(list, slots);
+    return new_queue;
+}
+
+void intskiplist_foreach(IntSkipList list, int (*callback_func)(int value)) {
+    if (_intskiplist_not_exists(list) || !callback_func) return;
+
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) curr->value = callback_func(curr->value);
+}
+
+long long intskiplist_reduce(const IntSkipList list, long long (*reduce_func)(long long acc, int value), long long initial) {
+    if (_intskiplist_not_exists(list) || !reduce_func) return initial;
+
+    long long acc = initial;
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) acc = reduce_func(acc, curr->value);
+    return acc;
+}
+
+bool intskiplist_any(const IntSkipList list, bool (*predicate_func)(int value)) {
+    if (_intskiplist_not_exists(list) || !predicate_func) return false;
+
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) if (predicate_func(curr->value)) return true;
+    return false;
+}
+
+bool intskiplist_all(const IntSkipList list, bool (*predicate_func)(int value)) {
+    if (_intskiplist_not_exists(list)) return false;
+    if (!predicate_func) return true;
+
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) if (!predicate_func(curr->value)) return false;
+    return true;
+}
+
+long long intskiplist_sum(const IntSkipList list) {
+    if (_intskiplist_not_exists(list)) return 0;
+
+    long long sum = 0;
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) sum += curr->value;
+    return sum;
+}
+
+void intskiplist_print(const IntSkipList list) {
+    if (intskiplist_is_empty(list)) {
+        printf("NULL");
+        return;
+    }
+
+    TextWriter writer;
+    _textio_writer_init(&writer, stdout);
+
+    for (IntSkipNode curr = list->header->links[0].next; curr; curr = curr->links[0].next) {
+        _textio_write_int(&writer, curr->value);
+        if (curr->links[0].next) _textio_write(&writer, " -> ", 4);
+    }
+    _textio_flush(&writer);
+}
@@ -0,0 +1,173 @@
+#include "queue/intspscqueue.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include "internal/memmngr.h"
+
+#define CACHE_LINE 64
+#define MIN_CAPACITY 16
+#define MAX_CAPACITY ((SIZE_MAX / sizeof (int)) / 2 + 1)
+
+// One producer thread owns tail and one consumer thread owns head; both only ever grow, so their difference is the size.
+// Each side keeps its own line with a cached copy of the other index, and only rereads the shared one when the cache says full or empty
+struct _intspscqueue {
+    alignas(CACHE_LINE) atomic_size_t tail;
+    size_t head_cache;
+
+    alignas(CACHE_LINE) atomic_size_t head;
+    size_t tail_cache;
+
+    alignas(CACHE_LINE) int* data;
+    size_t mask;
+    size_t limit;
+};
+
+static bool _intspscqueue_not_exists(const IntSpscQueue queue) {
+    return !queue;
+}
+
+static void _intspscqueue_free(IntSpscQueue queue) {
+    free(queue->data);
+    free(queue);
+}
+
+IntSpscQueue intspscqueue_new(size_t capacity) {
+    if (capacity == 0 || capacity > MAX_CAPACITY) return NULL;
+
+    size_t ring = MIN_CAPACITY;
+    while (ring < capacity) ring *= 2;
+
+    IntSpscQueue new_queue = (IntSpscQueue) aligned_alloc(CACHE_LINE, sizeof (struct _intspscqueue));
+    if (_intspscqueue_not_exists(new_queue)) return NULL;
+
+    int* data = (int*) aligned_alloc(CACHE_LINE, ring * sizeof (int));
+    if (!data) {
+        free(new_queue);
+        return NULL;
+    }
+
+    if (!_memmngr_register(new_queue, (void (*)(void*)) _intspscqueue_free)) {
+        free(data);
+        free(new_queue);
+        return NULL;
+    }
+
+    atomic_init(&new_queue->tail, 0);
+    atomic_init(&new_queue->head, 0);
+    new_queue->head_cache = 0;
+    new_queue->tail_cache = 0;
+    new_queue->data = data;
+    new_queue->mask = ring - 1;
+    new_queue->limit = capacity;
+    return new_queue;
+}
+
+// Producer side: room left before the queue is full, rereading head only when the cached copy says there is not enough
+static size_t _intspscqueue_room(IntSpscQueue queue, size_t tail, size_t wanted) {
+    size_t room = queue->limit - (tail - queue->head_cache);
+    if (room >= wanted) return room;
+
+    queue->head_cache = atomic_load_explicit(&queue->head, memory_order_acquire);
+    return queue->limit - (tail - queue->head_cache);
+}
+
+// Consumer side: values ready to be read, rereading tail only when the cached copy says there are not enough
+static size_t _intspscqueue_ready(IntSpscQueue queue, size_t head, size_t wanted) {
+    size_t ready = queue->tail_cache - head;
+    if (ready >= wanted) return ready;
+
+    queue->tail_cache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return queue->tail_cache - head;
+}
+
+bool intspscqueue_enqueue(IntSpscQueue queue, int value) {
+    if (_intspscqueue_not_exists(queue)) return false;
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (_intspscqueue_room(queue, tail, 1) == 0) return false;
+
+    queue->data[tail & queue->mask] = value;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+size_t intspscqueue_enqueue_n(IntSpscQueue queue, const int* arr, size_t size) {
+    if (_intspscqueue_not_exists(queue) || !arr || size == 0) return 0;
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t room = _intspscqueue_room(queue, tail, size);
+    if (size > room) size = room;
+    if (size == 0) return 0;
+
+    // At most two copies, split where the ring wraps, published with a single release
+    size_t slot = tail & queue->mask;
+    size_t first = queue->mask + 1 - slot;
+    if (first > size) first = size;
+
+    memcpy(queue->data + slot, arr, first * sizeof (int));
+    memcpy(queue->data, arr + first, (size - first) * sizeof (int));
+    atomic_store_explicit(&queue->tail, tail + size, memory_order_release);
+    return size;
+}
+
+bool intspscqueue_dequeue(IntSpscQueue queue, int* out) {
+    if (_intspscqueue_not_exists(queue)) return false;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (_intspscqueue_ready(queue, head, 1) == 0) return false;
+
+    if (out) *out = queue->data[head & queue->mask];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return true;
+}
+
+size_t intspscqueue_dequeue_n(IntSpscQueue queue, int* out, size_t size) {
+    if (_intspscqueue_not_exists(queue) || !out || size == 0) return 0;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t ready = _intspscqueue_ready(queue, head, size);
+    if (size > ready) size = ready;
+    if (size == 0) return 0;
+
+    size_t slot = head & queue->mask;
+    size_t first = queue->mask + 1 - slot;
+    if (first > size) first = size;
+
+    memcpy(out, queue->data + slot, first * sizeof (int));
+    memcpy(out + first, queue->data, (size - first) * sizeof (int));
+    atomic_store_explicit(&queue->head, head + size, memory_order_release);
+    return size;
+}
+
+bool intspscqueue_peek(const IntSpscQueue queue, int* out) {
+    if (_intspscqueue_not_exists(queue) || !out) return false;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (_intspscqueue_ready(queue, head, 1) == 0) return false;
+
+    *out = queue->data[head & queue->mask];
+    return true;
+}
+
+// Read from any thread, the size is a snapshot that may already be stale when it returns
+size_t intspscqueue_size(const IntSpscQueue queue) {
+    if (_intspscqueue_not_exists(queue)) return 0;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+bool intspscqueue_is_empty(const IntSpscQueue queue) {
+    return intspscqueue_size(queue) == 0;
+}
+
+bool intspscqueue_is_full(const IntSpscQueue queue) {
+    return !_intspscqueue_not_exists(queue) && intspscqueue_size(queue) == queue->limit;
+}
+
+size_t intspscqueue_capacity(const IntSpscQueue queue) {
+    return _intspscqueue_not_exists(queue) ? 0 : queue->limit;
+}
\ No newline at end of file
@@ -1,18 +1,24 @@
 #include "stack/intstack.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include "linkedlist/intlist.h"
 #include "queue/intqueue.h"
+#include "queue/intdeque.h"
 #include "internal/memmngr.h"
+#include "internal/fill.h"
 
-typedef struct _intnode {
-    int value;
-    struct _intnode* next;
-} *IntNode;
+#define INITIAL_CAPACITY 8
+#define GROWTH_FACTOR 2
+#define MAX_CAPACITY (SIZE_MAX / sizeof (int))
+#define COPY_BATCH 256
 
+// The top of the stack is the last element of data
 struct _intstack {
-    IntNode top;
+    int* data;
     size_t size;
+    size_t capacity;
 };
 
 static bool _intstack_not_exists(const IntStack stack) {
@@ -20,20 +26,34 @@ static bool _intstack_not_exists(const IntStack stack) {
 }
 
 bool intstack_is_empty(const IntStack stack) {
-    return _intstack_not_exists(stack) || !stack->top;
+    return _intstack_not_exists(stack) || stack->size == 0;
 }
 
-static IntNode _intstack_create_node(int value) {
-    IntNode new_node = (IntNode) malloc(sizeof (struct _intnode));
-    if (!new_node) return NULL;
+static void _intstack_free(IntStack stack) {
+    free(stack->data);
+    free(stack);
+}
+
+static bool _intstack_realloc(IntStack stack, size_t new_capacity) {
+    int* new_data = (int*) realloc(stack->data, sizeof (int) * new_capacity);
+    if (!new_data) return false;
 
-    *new_node = (struct _intnode) {.value = value, .next = NULL};
-    return new_node;
+    stack->data = new_data;
+    stack->capacity = new_capacity;
+    return true;
 }
 
-static void _intstack_free(IntStack stack) {
-    intstack_clear(stack);
-    free(stack);
+static bool _intstack_grow(IntStack stack, size_t extra) {
+    if (extra > MAX_CAPACITY - stack->size) return false;
+
+    size_t required = stack->size + extra;
+    if (required <= stack->capacity) return true;
+
+    size_t new_capacity = stack->capacity ? stack->capacity : INITIAL_CAPACITY;
+    while (new_capacity < required) {
+        new_capacity = new_capacity > MAX_CAPACITY / GROWTH_FACTOR ? MAX_CAPACITY : new_capacity * GROWTH_FACTOR;
+    }
+    return _intstack_realloc(stack, new_capacity);
 }
 
 IntStack intstack_new(void) {
@@ -45,51 +65,65 @@ IntStack intstack_new(void) {
         return NULL;
     }
 
-    *new_stack = (struct _intstack) {.top = NULL, .size = 0};
+    *new_stack = (struct _intstack) {.data = NULL, .size = 0, .capacity = 0};
     return new_stack;
 }
 
+// The storage is kept, so refilling a cleared stack does not reallocate
 void intstack_clear(IntStack stack) {
     if (_intstack_not_exists(stack)) return;
+    stack->size = 0;
+}
 
-    for (IntNode curr = stack->top, next; curr; curr = next) {
-        next = curr->next;
-        free(curr);
-    }
+int* _intstack_fill(IntStack stack, size_t count) {
+    if (!_intstack_grow(stack, count)) return NULL;
 
-    stack->top = NULL;
-    stack->size = 0;
+    stack->size = count;
+    return stack->data;
+}
+
+void _intstack_adopt(IntStack stack, int* data, size_t capacity, size_t size) {
+    free(stack->data);
+    *stack = (struct _intstack) {.data = data, .size = size, .capacity = capacity};
+}
+
+bool intstack_reserve(IntStack stack, size_t capacity) {
+    if (_intstack_not_exists(stack) || capacity > MAX_CAPACITY) return false;
+    return capacity <= stack->capacity || _intstack_realloc(stack, capacity);
+}
+
+size_t intstack_capacity(const IntStack stack) {
+    return _intstack_not_exists(stack) ? 0 : stack->capacity;
 }
 
 bool intstack_push(IntStack stack, int value) {
-    if (_intstack_not_exists(stack)) return false;
+    if (_intstack_not_exists(stack) || !_intstack_grow(stack, 1)) return false;
 
-    IntNode new_node = _intstack_create_node(value);
-    if (!new_node) return false;
+    stack->data[stack->size++] = value;
+    return true;
+}
 
-    new_node->next = stack->top;
-    stack->top = new_node;
+bool intstack_push_n(IntStack stack, const int* arr, size_t size) {
+    if (_intstack_not_exists(stack) || (!arr && size > 0)) return false;
+    if (size == 0) return true;
+    if (!_intstack_grow(stack, size)) return false;
 
-    stack->size++;
+    memcpy(stack->data + stack->size, arr, sizeof (int) * size);
+    stack->size += size;
     return true;
 }
 
 bool intstack_pop(IntStack stack, int* out) {
     if (intstack_is_empty(stack)) return false;
 
-    IntNode top = stack->top;
-    if (out) *out = top->value;
-
-    stack->top = top->next;
-    free(top);
-
     stack->size--;
+    if (out) *out = stack->data[stack->size];
     return true;
 }
 
 bool intstack_peek(const IntStack stack, int* out) {
     if (intstack_is_empty(stack) || !out) return false;
-    *out = stack->top->value;
+    *out = stack->data[stack->size - 1];
     return true;
 }
 
@@ -97,17 +131,16 @@ size_t intstack_size(const IntStack stack) {
     return _intstack_not_exists(stack) ? 0 : stack->size;
 }
 
+// Conversions walk the stack from top to bottom
 IntList intstack_to_list(const IntStack stack) {
     if (_intstack_not_exists(stack)) return NULL;
 
     IntList new_list = intlist_new();
-    if (!new_list) return NULL;
+    if (!new_list || intstack_is_empty(stack)) return new_list;
 
-    for (IntNode curr = stack->top; curr; curr = curr->next) {
-        if (!intlist_push(new_list, curr->value)) {
-            _memmngr_rollback();
-            return NULL;
-        }
+    if (!_intlist_push_reversed(new_list, stack->data, stack->size)) {
+        _memmngr_rollback();
+        return NULL;
     }
     return new_list;
 }
@@ -116,13 +149,76 @@ IntQueue intstack_to_queue(const IntStack stack) {
     if (_intstack_not_exists(stack)) return NULL;
     
     IntQueue new_queue = intqueue_new();
-    if (!new_queue) return NULL;
-    
-    for (IntNode curr = stack->top; curr; curr = curr->next) {
-        if (!intqueue_enqueue(new_queue, curr->value)) {
+    if (!new_queue || intstack_is_empty(stack)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, stack->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    for (size_t i = stack->size; i-- > 0;) *slots++ = stack->data[i];
+    return new_queue;
+}
+
+// The top of the stack becomes the front of the deque, so the array is appended from the top down in reversed on-stack
+// batches
+IntDeque intstack_to_deque(const IntStack stack) {
+    if (_intstack_not_exists(stack)) return NULL;
+
+    IntDeque new_deque = intdeque_new();
+    if (!new_deque || intstack_is_empty(stack)) return new_deque;
+
+    int batch[COPY_BATCH];
+    for (size_t top = stack->size, count; top > 0; top -= count) {
+        count = top < COPY_BATCH ? top : COPY_BATCH;
+        for (size_t i = 0; i < count; i++) batch[i] = stack->data[top - 1 - i];
+
+        if (!intdeque_push_back_n(new_deque, batch, count)) {
             _memmngr_rollback();
             return NULL;
         }
-    }    
+    }
+    return new_deque;
+}
+
+static void _intstack_reverse(IntStack stack) {
+    for (size_t i = 0, j = stack->size - 1; i < j; i++, j--) {
+        int temp = stack->data[i];
+        stack->data[i] = stack->data[j];
+        stack->data[j] = temp;
+    }
+}
+
+static void _intstack_disown(IntStack stack) {
+    *stack = (struct _intstack) {.data = NULL, .size = 0, .capacity = 0};
+}
+
+// Copy and free rather than a move: nodes cannot reuse the array, so the values are copied once into a freshly allocated
+// list and the array is released
+IntList intstack_into_list(IntStack stack) {
+    IntList new_list = intstack_to_list(stack);
+    if (new_list) {
+        free(stack->data);
+        _intstack_disown(stack);
+    }
+    return new_list;
+}
+
+// Reversed in place, the array already is the queue front to back, so it becomes the queue's ring without a copy
+IntQueue intstack_into_queue(IntStack stack) {
+    if (_intstack_not_exists(stack)) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (!new_queue || intstack_is_empty(stack)) return new_queue;
+
+    _intstack_reverse(stack);
+    if (!_intqueue_adopt(new_queue, stack->data, stack->capacity, stack->size)) {
+        _intstack_reverse(stack);
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    _intstack_disown(stack);
     return new_queue;
 }
\ No newline at end of file
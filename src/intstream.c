@@ -0,0 +1,282 @@
+#include "stream/intstream.h"
+#include <stdlib.h>
+#include "linkedlist/intlist.h"
+#include "arraylist/intvec.h"
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+#include "internal/visit.h"
+
+#define INITIAL_STAGES 4
+#define STACK_BUDGETS 16
+
+typedef enum {
+    STAGE_MAP,
+    STAGE_FILTER,
+    STAGE_TAKE,
+    STAGE_SKIP,
+} IntStageKind;
+
+typedef struct _intstage {
+    IntStageKind kind;
+    int (*callback_func)(int value);
+    bool (*predicate_func)(int value);
+    size_t count;
+} IntStage;
+
+// Stages only describe the pipeline; nothing runs until a terminal operation walks the source once
+struct _intstream {
+    void (*visit_func)(const void* source, IntVisitor visit_func, void* ctx);
+    const void* source;
+    const int* arr;
+    size_t arr_size;
+    IntStage* stages;
+    size_t stages_num;
+    size_t stages_capacity;
+};
+
+// State of a single terminal operation: the remaining take/skip budgets and what the sink has accumulated
+typedef struct _intstreamrun {
+    const IntStream stream;
+    size_t* remaining;
+    bool (*sink_func)(struct _intstreamrun* run, int value);
+    long long (*reduce_func)(long long acc, int value);
+    long long acc;
+    IntList list;
+    IntVec vec;
+    bool failed;
+} IntStreamRun;
+
+static bool _intstream_not_exists(const IntStream stream) {
+    return !stream;
+}
+
+static void _intstream_free(IntStream stream) {
+    free(stream->stages);
+    free(stream);
+}
+
+static void _intstream_visit_array(const void* source, IntVisitor visit_func, void* ctx) {
+    const IntStream stream = (const IntStream) source;
+    for (size_t i = 0; i < stream->arr_size && visit_func(stream->arr[i], ctx); i++);
+}
+
+static void _intstream_visit_list(const void* source, IntVisitor visit_func, void* ctx) {
+    _intlist_visit((const IntList) source, visit_func, ctx);
+}
+
+static void _intstream_visit_vec(const void* source, IntVisitor visit_func, void* ctx) {
+    _intvec_visit((const IntVec) source, visit_func, ctx);
+}
+
+static void _intstream_visit_queue(const void* source, IntVisitor visit_func, void* ctx) {
+    _intqueue_visit((const IntQueue) source, visit_func, ctx);
+}
+
+static IntStream _intstream_new(void (*visit_func)(const void* source, IntVisitor visit_func, void* ctx), const void* source) {
+    IntStream new_stream = (IntStream) malloc(sizeof (struct _intstream));
+    if (_intstream_not_exists(new_stream)) return NULL;
+
+    if (!_memmngr_register(new_stream, (void (*)(void*)) _intstream_free)) {
+        free(new_stream);
+        return NULL;
+    }
+
+    *new_stream = (struct _intstream) {.visit_func = visit_func, .source = source, .stages = NULL, .stages_num = 0, .stages_capacity = 0};
+    return new_stream;
+}
+
+static IntStream _intstream_add_stage(IntStream stream, IntStage stage) {
+    if (_intstream_not_exists(stream)) return NULL;
+
+    if (stream->stages_num == stream->stages_capacity) {
+        size_t new_capacity = stream->stages_capacity ? stream->stages_capacity * 2 : INITIAL_STAGES;
+
+        IntStage* new_stages = (IntStage*) realloc(stream->stages, sizeof (IntStage) * new_capacity);
+        if (!new_stages) return NULL;
+
+        stream->stages = new_stages;
+        stream->stages_capacity = new_capacity;
+    }
+
+    stream->stages[stream->stages_num++] = stage;
+    return stream;
+}
+
+IntStream intstream_from_list(const IntList list) {
+    return list ? _intstream_new(_intstream_visit_list, list) : NULL;
+}
+
+IntStream intstream_from_vec(const IntVec vec) {
+    return vec ? _intstream_new(_intstream_visit_vec, vec) : NULL;
+}
+
+IntStream intstream_from_queue(const IntQueue queue) {
+    return queue ? _intstream_new(_intstream_visit_queue, queue) : NULL;
+}
+
+IntStream intstream_from_array(const int* arr, size_t size) {
+    if (!arr && size > 0) return NULL;
+
+    IntStream new_stream = _intstream_new(_intstream_visit_array, NULL);
+    if (_intstream_not_exists(new_stream)) return NULL;
+
+    new_stream->source = new_stream;
+    new_stream->arr = arr;
+    new_stream->arr_size = size;
+    return new_stream;
+}
+
+IntStream intstream_map(IntStream stream, int (*callback_func)(int value)) {
+    if (!callback_func) return stream;
+    return _intstream_add_stage(stream, (IntStage) {.kind = STAGE_MAP, .callback_func = callback_func});
+}
+
+IntStream intstream_filter(IntStream stream, bool (*predicate_func)(int value)) {
+    if (!predicate_func) return stream;
+    return _intstream_add_stage(stream, (IntStage) {.kind = STAGE_FILTER, .predicate_func = predicate_func});
+}
+
+IntStream intstream_take(IntStream stream, size_t count) {
+    return _intstream_add_stage(stream, (IntStage) {.kind = STAGE_TAKE, .count = count});
+}
+
+IntStream intstream_skip(IntStream stream, size_t count) {
+    return _intstream_add_stage(stream, (IntStage) {.kind = STAGE_SKIP, .count = count});
+}
+
+// Runs one source value through every stage and into the sink; returning false stops the source walk
+static bool _intstream_push(int value, void* ctx) {
+    IntStreamRun* run = ctx;
+    const IntStream stream = run->stream;
+
+    bool exhausted = false;
+    for (size_t i = 0; i < stream->stages_num; i++) {
+        IntStage* stage = &stream->stages[i];
+        switch (stage->kind) {
+            case STAGE_MAP:
+                value = stage->callback_func(value);
+                break;
+            // A value dropped after a take that just ran out still ends the walk, so no upstream callback runs again
+            case STAGE_FILTER:
+                if (!stage->predicate_func(value)) return !exhausted;
+                break;
+            case STAGE_SKIP:
+                if (run->remaining[i] > 0) {
+                    run->remaining[i]--;
+                    return !exhausted;
+                }
+                break;
+            case STAGE_TAKE:
+                // Once a take stage has let its last value through, nothing downstream can receive more
+                if (run->remaining[i] == 0) return false;
+                if (--run->remaining[i] == 0) exhausted = true;
+                break;
+        }
+    }
+    return run->sink_func(run, value) && !exhausted;
+}
+
+static void _intstream_run(IntStreamRun* run) {
+    const IntStream stream = run->stream;
+
+    // Budgets belong to the run, so a stream can be run again from a callback or from another thread; only long
+    // pipelines spill them to the heap
+    size_t budgets[STACK_BUDGETS];
+    size_t* remaining = budgets;
+    if (stream->stages_num > STACK_BUDGETS) {
+        remaining = (size_t*) malloc(sizeof (size_t) * stream->stages_num);
+        if (!remaining) {
+            run->failed = true;
+            return;
+        }
+    }
+
+    bool empty = false;
+    for (size_t i = 0; i < stream->stages_num; i++) {
+        remaining[i] = stream->stages[i].count;
+        if (stream->stages[i].kind == STAGE_TAKE && remaining[i] == 0) empty = true;
+    }
+
+    run->remaining = remaining;
+    if (!empty) stream->visit_func(stream->source, _intstream_push, run);
+    if (remaining != budgets) free(remaining);
+}
+
+static bool _intstream_sink_list(IntStreamRun* run, int value) {
+    if (!intlist_push(run->list, value)) run->failed = true;
+    return !run->failed;
+}
+
+static bool _intstream_sink_vec(IntStreamRun* run, int value) {
+    if (!intvec_push(run->vec, value)) run->failed = true;
+    return !run->failed;
+}
+
+static bool _intstream_sink_reduce(IntStreamRun* run, int value) {
+    run->acc = run->reduce_func(run->acc, value);
+    return true;
+}
+
+static bool _intstream_sink_sum(IntStreamRun* run, int value) {
+    run->acc += value;
+    return true;
+}
+
+static bool _intstream_sink_count(IntStreamRun* run, int value) {
+    run->acc++;
+    return true;
+}
+
+IntList intstream_collect(const IntStream stream) {
+    if (_intstream_not_exists(stream)) return NULL;
+
+    IntList new_list = intlist_new();
+    if (!new_list) return NULL;
+
+    IntStreamRun run = {.stream = stream, .sink_func = _intstream_sink_list, .list = new_list};
+    _intstream_run(&run);
+    if (run.failed) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_list;
+}
+
+IntVec intstream_collect_vec(const IntStream stream) {
+    if (_intstream_not_exists(stream)) return NULL;
+
+    IntVec new_vec = intvec_new();
+    if (!new_vec) return NULL;
+
+    IntStreamRun run = {.stream = stream, .sink_func = _intstream_sink_vec, .vec = new_vec};
+    _intstream_run(&run);
+    if (run.failed) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_vec;
+}
+
+long long intstream_reduce(const IntStream stream, long long (*reduce_func)(long long acc, int value), long long initial) {
+    if (_intstream_not_exists(stream) || !reduce_func) return initial;
+
+    IntStreamRun run = {.stream = stream, .sink_func = _intstream_sink_reduce, .reduce_func = reduce_func, .acc = initial};
+    _intstream_run(&run);
+    return run.acc;
+}
+
+long long intstream_sum(const IntStream stream) {
+    if (_intstream_not_exists(stream)) return 0;
+
+    IntStreamRun run = {.stream = stream, .sink_func = _intstream_sink_sum, .acc = 0};
+    _intstream_run(&run);
+    return run.acc;
+}
+
+size_t intstream_count(const IntStream stream) {
+    if (_intstream_not_exists(stream)) return 0;
+
+    IntStreamRun run = {.stream = stream, .sink_func = _intstream_sink_count, .acc = 0};
+    _intstream_run(&run);
+    return (size_t) run.acc;
+}
@@ -0,0 +1,548 @@
+#include "arraylist/intvec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+#include "internal/memmngr.h"
+#include "internal/simd.h"
+#include "internal/threadpool.h"
+#include "internal/visit.h"
+#include "internal/fill.h"
+#include "internal/textio.h"
+
+#define INITIAL_CAPACITY 8
+#define GROWTH_FACTOR 2
+#define MAX_CAPACITY (SIZE_MAX / sizeof (int))
+
+struct _intvec {
+    int* data;
+    size_t size;
+    size_t capacity;
+};
+
+static bool _intvec_not_exists(const IntVec vec) {
+    return !vec;
+}
+
+bool intvec_is_empty(const IntVec vec) {
+    return _intvec_not_exists(vec) || vec->size == 0;
+}
+
+static void _intvec_free(IntVec vec) {
+    free(vec->data);
+    free(vec);
+}
+
+static bool _intvec_realloc(IntVec vec, size_t new_capacity) {
+    int* new_data = (int*) realloc(vec->data, sizeof (int) * new_capacity);
+    if (!new_data) return false;
+
+    vec->data = new_data;
+    vec->capacity = new_capacity;
+    return true;
+}
+
+// Makes room for extra more elements, doubling the capacity so a sequence of pushes costs amortized O(1)
+static bool _intvec_grow(IntVec vec, size_t extra) {
+    if (extra > MAX_CAPACITY - vec->size) return false;
+
+    size_t required = vec->size + extra;
+    if (required <= vec->capacity) return true;
+
+    size_t new_capacity = vec->capacity ? vec->capacity : INITIAL_CAPACITY;
+    while (new_capacity < required) {
+        new_capacity = new_capacity > MAX_CAPACITY / GROWTH_FACTOR ? MAX_CAPACITY : new_capacity * GROWTH_FACTOR;
+    }
+    return _intvec_realloc(vec, new_capacity);
+}
+
+IntVec intvec_new(void) {
+    IntVec new_vec = (IntVec) malloc(sizeof (struct _intvec));
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    if (!_memmngr_register(new_vec, (void (*)(void*)) _intvec_free)) {
+        free(new_vec);
+        return NULL;
+    }
+
+    *new_vec = (struct _intvec) {.data = NULL, .size = 0, .capacity = 0};
+    return new_vec;
+}
+
+IntVec intvec_with_capacity(size_t capacity) {
+    IntVec new_vec = intvec_new();
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    if (!intvec_reserve(new_vec, capacity)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_vec;
+}
+
+IntVec intvec_from_array(const int* arr, size_t size) {
+    if (!arr || size == 0) return NULL;
+
+    IntVec new_vec = intvec_with_capacity(size);
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    memcpy(new_vec->data, arr, sizeof (int) * size);
+    new_vec->size = size;
+    return new_vec;
+}
+
+void intvec_clear(IntVec vec) {
+    if (_intvec_not_exists(vec)) return;
+    vec->size = 0;
+}
+
+bool intvec_reserve(IntVec vec, size_t capacity) {
+    if (_intvec_not_exists(vec) || capacity > MAX_CAPACITY) return false;
+    return capacity <= vec->capacity || _intvec_realloc(vec, capacity);
+}
+
+bool intvec_shrink_to_fit(IntVec vec) {
+    if (_intvec_not_exists(vec)) return false;
+    if (vec->size == vec->capacity) return true;
+
+    if (vec->size == 0) {
+        free(vec->data);
+        vec->data = NULL;
+        vec->capacity = 0;
+        return true;
+    }
+    return _intvec_realloc(vec, vec->size);
+}
+
+bool intvec_push(IntVec vec, int value) {
+    if (_intvec_not_exists(vec) || !_intvec_grow(vec, 1)) return false;
+
+    vec->data[vec->size++] = value;
+    return true;
+}
+
+bool intvec_push_at(IntVec vec, int value, size_t index) {
+    if (_intvec_not_exists(vec) || index > vec->size || !_intvec_grow(vec, 1)) return false;
+
+    memmove(vec->data + index + 1, vec->data + index, sizeof (int) * (vec->size - index));
+    vec->data[index] = value;
+    vec->size++;
+    return true;
+}
+
+bool intvec_append_array(IntVec vec, const int* arr, size_t size) {
+    if (_intvec_not_exists(vec) || (!arr && size > 0) || !_intvec_grow(vec, size)) return false;
+    if (size == 0) return true;
+
+    memcpy(vec->data + vec->size, arr, sizeof (int) * size);
+    vec->size += size;
+    return true;
+}
+
+void intvec_pop(IntVec vec) {
+    if (intvec_is_empty(vec)) return;
+    vec->size--;
+}
+
+void intvec_pop_at(IntVec vec, size_t index) {
+    if (intvec_is_empty(vec) || index >= vec->size) return;
+
+    memmove(vec->data + index, vec->data + index + 1, sizeof (int) * (vec->size - index - 1));
+    vec->size--;
+}
+
+size_t intvec_size(const IntVec vec) {
+    return _intvec_not_exists(vec) ? 0 : vec->size;
+}
+
+size_t intvec_capacity(const IntVec vec) {
+    return _intvec_not_exists(vec) ? 0 : vec->capacity;
+}
+
+bool intvec_front(const IntVec vec, int* out) {
+    if (intvec_is_empty(vec) || !out) return false;
+    *out = vec->data[0];
+    return true;
+}
+
+bool intvec_get_at(const IntVec vec, size_t index, int* out) {
+    if (intvec_is_empty(vec) || !out || index >= vec->size) return false;
+    *out = vec->data[index];
+    return true;
+}
+
+bool intvec_set_at(IntVec vec, size_t index, int value) {
+    if (intvec_is_empty(vec) || index >= vec->size) return false;
+    vec->data[index] = value;
+    return true;
+}
+
+bool intvec_back(const IntVec vec, int* out) {
+    if (intvec_is_empty(vec) || !out) return false;
+    *out = vec->data[vec->size - 1];
+    return true;
+}
+
+int intvec_index(const IntVec vec, int target) {
+    if (_intvec_not_exists(vec)) return -1;
+
+    size_t index = _simd_find_int(vec->data, vec->size, target);
+    return index < vec->size ? (int) index : -1;
+}
+
+size_t intvec_count(const IntVec vec, int target) {
+    if (_intvec_not_exists(vec)) return 0;
+
+    return _simd_count_int(vec->data, vec->size, target);
+}
+
+bool intvec_contains(const IntVec vec, int target) {
+    if (_intvec_not_exists(vec)) return false;
+
+    return _simd_find_int(vec->data, vec->size, target) < vec->size;
+}
+
+bool intvec_equals(const IntVec vec1, const IntVec vec2) {
+    if (_intvec_not_exists(vec1) || _intvec_not_exists(vec2) || vec1->size != vec2->size) return false;
+    return _simd_equals_int(vec1->data, vec2->data, vec1->size);
+}
+
+IntVec intvec_copy(const IntVec vec) {
+    if (_intvec_not_exists(vec)) return NULL;
+
+    IntVec copy = intvec_with_capacity(vec->size);
+    if (_intvec_not_exists(copy)) return NULL;
+
+    if (vec->size > 0) memcpy(copy->data, vec->data, sizeof (int) * vec->size);
+    copy->size = vec->size;
+    return copy;
+}
+
+IntVec intvec_map(const IntVec vec, int (*callback_func)(int value)) {
+    if (_intvec_not_exists(vec)) return NULL;
+    if (!callback_func) return intvec_copy(vec);
+
+    IntVec new_vec = intvec_with_capacity(vec->size);
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    for (size_t i = 0; i < vec->size; i++) new_vec->data[i] = callback_func(vec->data[i]);
+    new_vec->size = vec->size;
+    return new_vec;
+}
+
+IntVec intvec_filter(const IntVec vec, bool (*predicate_func)(int value)) {
+    if (_intvec_not_exists(vec)) return NULL;
+    if (!predicate_func) return intvec_copy(vec);
+
+    IntVec new_vec = intvec_new();
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    for (size_t i = 0; i < vec->size; i++) {
+        if (predicate_func(vec->data[i])) {
+            if (!intvec_push(new_vec, vec->data[i])) {
+                _memmngr_rollback();
+                return NULL;
+            }
+        }
+    }
+    return new_vec;
+}
+
+IntVec intvec_zip(const IntVec vec1, const IntVec vec2) {
+    if (_intvec_not_exists(vec1) || _intvec_not_exists(vec2)) return NULL;
+
+    size_t pairs = vec1->size < vec2->size ? vec1->size : vec2->size;
+
+    IntVec new_vec = intvec_with_capacity(pairs * 2);
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    for (size_t i = 0; i < pairs; i++) {
+        new_vec->data[2 * i] = vec1->data[i];
+        new_vec->data[2 * i + 1] = vec2->data[i];
+    }
+    new_vec->size = pairs * 2;
+    return new_vec;
+}
+
+int* intvec_to_array(const IntVec vec) {
+    if (intvec_is_empty(vec)) return NULL;
+
+    int* arr = (int*) malloc(sizeof (int) * vec->size);
+    if (!arr) return NULL;
+
+    if (!_memmngr_register(arr, free)) {
+        free(arr);
+        return NULL;
+    }
+
+    memcpy(arr, vec->data, sizeof (int) * vec->size);
+    return arr;
+}
+
+IntList intvec_to_list(const IntVec vec) {
+    if (_intvec_not_exists(vec)) return NULL;
+
+    IntList new_list = intlist_new();
+    if (!new_list || intvec_is_empty(vec)) return new_list;
+
+    if (!intlist_push_n(new_list, vec->data, vec->size)) {
+        _memmngr_rollback();
+        return NULL;
+    }
+    return new_list;
+}
+
+// The end of the vector becomes the top of the stack, which is also the order of the stack's array
+IntStack intvec_to_stack(const IntVec vec) {
+    if (_intvec_not_exists(vec)) return NULL;
+
+    IntStack new_stack = intstack_new();
+    if (!new_stack || intvec_is_empty(vec)) return new_stack;
+
+    int* slots = _intstack_fill(new_stack, vec->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    memcpy(slots, vec->data, sizeof (int) * vec->size);
+    return new_stack;
+}
+
+IntQueue intvec_to_queue(const IntVec vec) {
+    if (_intvec_not_exists(vec)) return NULL;
+
+    IntQueue new_queue = intqueue_new();
+    if (!new_queue || intvec_is_empty(vec)) return new_queue;
+
+    int* slots = _intqueue_fill(new_queue, vec->size);
+    if (!slots) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    memcpy(slots, vec->data, sizeof (int) * vec->size);
+    return new_queue;
+}
+
+void intvec_reverse(IntVec vec) {
+    if (_intvec_not_exists(vec) || vec->size < 2) return;
+
+    for (size_t i = 0, j = vec->size - 1; i < j; i++, j--) {
+        int tmp = vec->data[i];
+        vec->data[i] = vec->data[j];
+        vec->data[j] = tmp;
+    }
+}
+
+// Storage is already contiguous, so batch callbacks get the whole vector in one call; only filter needs a block-sized flag buffer
+#define BATCH_SIZE 256
+
+void intvec_foreach_batch(IntVec vec, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx) {
+    if (intvec_is_empty(vec) || !batch_func) return;
+    batch_func(vec->data, vec->size, ctx);
+}
+
+IntVec intvec_map_batch(const IntVec vec, void (*batch_func)(int* values, size_t size, void* ctx), void* ctx) {
+    IntVec new_vec = intvec_copy(vec);
+    if (!intvec_is_empty(new_vec) && batch_func) batch_func(new_vec->data, new_vec->size, ctx);
+    return new_vec;
+}
+
+IntVec intvec_filter_batch(const IntVec vec, void (*batch_func)(const int* values, bool* keep, size_t size, void* ctx), void* ctx) {
+    if (_intvec_not_exists(vec)) return NULL;
+    if (!batch_func) return intvec_copy(vec);
+
+    IntVec new_vec = intvec_with_capacity(vec->size);
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    bool keep[BATCH_SIZE];
+    for (size_t start = 0; start < vec->size; start += BATCH_SIZE) {
+        size_t size = vec->size - start < BATCH_SIZE ? vec->size - start : BATCH_SIZE;
+        batch_func(vec->data + start, keep, size, ctx);
+
+        for (size_t i = 0; i < size; i++) {
+            if (keep[i]) new_vec->data[new_vec->size++] = vec->data[start + i];
+        }
+    }
+    return new_vec;
+}
+
+long long intvec_reduce_batch(const IntVec vec, long long (*batch_func)(long long acc, const int* values, size_t size, void* ctx), long long initial, void* ctx) {
+    if (intvec_is_empty(vec) || !batch_func) return initial;
+    return batch_func(initial, vec->data, vec->size, ctx);
+}
+
+void _intvec_visit(const IntVec vec, IntVisitor visit_func, void* ctx) {
+    if (_intvec_not_exists(vec)) return;
+
+    for (size_t i = 0; i < vec->size && visit_func(vec->data[i], ctx); i++);
+}
+
+void intvec_foreach(IntVec vec, int (*callback_func)(int value)) {
+    if (_intvec_not_exists(vec) || !callback_func) return;
+
+    for (size_t i = 0; i < vec->size; i++) vec->data[i] = callback_func(vec->data[i]);
+}
+
+long long intvec_reduce(const IntVec vec, long long (*reduce_func)(long long acc, int value), long long initial) {
+    if (_intvec_not_exists(vec) || !reduce_func) return initial;
+
+    long long acc = initial;
+    for (size_t i = 0; i < vec->size; i++) acc = reduce_func(acc, vec->data[i]);
+    return acc;
+}
+
+bool intvec_any(const IntVec vec, bool (*predicate_func)(int value)) {
+    if (_intvec_not_exists(vec) || !predicate_func) return false;
+
+    for (size_t i = 0; i < vec->size; i++) if (predicate_func(vec->data[i])) return true;
+    return false;
+}
+
+bool intvec_all(const IntVec vec, bool (*predicate_func)(int value)) {
+    if (_intvec_not_exists(vec)) return false;
+    if (!predicate_func) return true;
+
+    for (size_t i = 0; i < vec->size; i++) if (!predicate_func(vec->data[i])) return false;
+    return true;
+}
+
+long long intvec_sum(const IntVec vec) {
+    if (_intvec_not_exists(vec)) return 0;
+
+    return _simd_sum_int(vec->data, vec->size);
+}
+
+bool intvec_min(const IntVec vec, int* out) {
+    if (intvec_is_empty(vec) || !out) return false;
+    *out = _simd_min_int(vec->data, vec->size);
+    return true;
+}
+
+bool intvec_max(const IntVec vec, int* out) {
+    if (intvec_is_empty(vec) || !out) return false;
+    *out = _simd_max_int(vec->data, vec->size);
+    return true;
+}
+
+// Chunk i covers [i * size / chunks, (i + 1) * size / chunks) of the source, and the same range of the output
+typedef struct _intvecjob {
+    const int* src;
+    int* dst;
+    size_t size;
+    size_t chunks;
+    size_t* kept;
+    long long* partials;
+    int (*callback_func)(int value);
+    bool (*predicate_func)(int value);
+    long long (*reduce_func)(long long acc, int value);
+    long long identity;
+} IntVecJob;
+
+static void _intvec_chunk_bounds(const IntVecJob* job, size_t index, size_t* start, size_t* end) {
+    *start = index * job->size / job->chunks;
+    *end = (index + 1) * job->size / job->chunks;
+}
+
+static void _intvec_par_map_task(void* arg, size_t index) {
+    IntVecJob* job = arg;
+    size_t start, end;
+    _intvec_chunk_bounds(job, index, &start, &end);
+
+    for (size_t i = start; i < end; i++) job->dst[i] = job->callback_func(job->src[i]);
+}
+
+static void _intvec_par_filter_task(void* arg, size_t index) {
+    IntVecJob* job = arg;
+    size_t start, end;
+    _intvec_chunk_bounds(job, index, &start, &end);
+
+    size_t kept = start;
+    for (size_t i = start; i < end; i++) {
+        if (job->predicate_func(job->src[i])) job->dst[kept++] = job->src[i];
+    }
+    job->kept[index] = kept - start;
+}
+
+static void _intvec_par_reduce_task(void* arg, size_t index) {
+    IntVecJob* job = arg;
+    size_t start, end;
+    _intvec_chunk_bounds(job, index, &start, &end);
+
+    long long acc = job->identity;
+    for (size_t i = start; i < end; i++) acc = job->reduce_func(acc, job->src[i]);
+    job->partials[index] = acc;
+}
+
+IntVec intvec_par_map(const IntVec vec, int (*callback_func)(int value)) {
+    if (_intvec_not_exists(vec) || !callback_func || vec->size < PAR_SEQUENTIAL_CUTOFF) return intvec_map(vec, callback_func);
+
+    IntVec new_vec = intvec_with_capacity(vec->size);
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    IntVecJob job = {.src = vec->data, .dst = new_vec->data, .size = vec->size, .chunks = _threadpool_chunks(vec->size), .callback_func = callback_func};
+    _threadpool_run(_intvec_par_map_task, &job, job.chunks);
+
+    new_vec->size = vec->size;
+    return new_vec;
+}
+
+IntVec intvec_par_filter(const IntVec vec, bool (*predicate_func)(int value)) {
+    if (_intvec_not_exists(vec) || !predicate_func || vec->size < PAR_SEQUENTIAL_CUTOFF) return intvec_filter(vec, predicate_func);
+
+    IntVec new_vec = intvec_with_capacity(vec->size);
+    if (_intvec_not_exists(new_vec)) return NULL;
+
+    IntVecJob job = {.src = vec->data, .dst = new_vec->data, .size = vec->size, .chunks = _threadpool_chunks(vec->size), .predicate_func = predicate_func};
+    job.kept = (size_t*) malloc(sizeof (size_t) * job.chunks);
+    if (!job.kept) {
+        _memmngr_rollback();
+        return NULL;
+    }
+
+    // Each chunk filters into its own slice of the output; the slices are then packed together in order
+    _threadpool_run(_intvec_par_filter_task, &job, job.chunks);
+    for (size_t i = 0; i < job.chunks; i++) {
+        size_t start = i * job.size / job.chunks;
+        memmove(new_vec->data + new_vec->size, new_vec->data + start, sizeof (int) * job.kept[i]);
+        new_vec->size += job.kept[i];
+    }
+
+    free(job.kept);
+    return new_vec;
+}
+
+long long intvec_par_reduce(const IntVec vec, long long (*reduce_func)(long long acc, int value), long long (*combine_func)(long long acc1, long long acc2), long long identity) {
+    if (_intvec_not_exists(vec) || !reduce_func) return identity;
+    if (!combine_func || vec->size < PAR_SEQUENTIAL_CUTOFF) return intvec_reduce(vec, reduce_func, identity);
+
+    IntVecJob job = {.src = vec->data, .size = vec->size, .chunks = _threadpool_chunks(vec->size), .reduce_func = reduce_func, .identity = identity};
+    job.partials = (long long*) malloc(sizeof (long long) * job.chunks);
+    if (!job.partials) return intvec_reduce(vec, reduce_func, identity);
+
+    _threadpool_run(_intvec_par_reduce_task, &job, job.chunks);
+
+    // Partial results are combined left to right, so only associativity is required of combine_func
+    long long acc = identity;
+    for (size_t i = 0; i < job.chunks; i++) acc = combine_func(acc, job.partials[i]);
+
+    free(job.partials);
+    return acc;
+}
+
+void intvec_print(const IntVec vec) {
+    TextWriter writer;
+    _textio_writer_init(&writer, stdout);
+
+    _textio_write(&writer, "[", 1);
+    for (size_t i = 0; !_intvec_not_exists(vec) && i < vec->size; i++) {
+        _textio_write_int(&writer, vec->data[i]);
+        if (i + 1 < vec->size) _textio_write(&writer, ", ", 2);
+    }
+    _textio_write(&writer, "]", 1);
+    _textio_flush(&writer);
+}
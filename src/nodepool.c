@@ -0,0 +1,151 @@
+#include "internal/nodepool.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+#define SLAB_BYTES 16384
+
+typedef struct _nodeslab* NodeSlab;
+
+// Only slabs with a free node are linked into the pool; full ones are found again through their nodes when freed.
+// A destroyed pool lingers, detached, until the last slab still holding another list's nodes empties
+struct _nodepool {
+    size_t node_size;
+    NodeSlab partial;
+    NodeSlab partial_tail;
+    size_t free_count;
+    size_t slabs;
+    NodeSlab spare;
+    bool detached;
+};
+
+// Slabs are aligned to their own size, so the slab a node belongs to is found by masking the node's address
+struct _nodeslab {
+    NodePool owner;
+    NodeSlab prev;
+    NodeSlab next;
+    void* free_nodes;
+    char* bump;
+    size_t unused;
+    size_t live;
+    max_align_t nodes[];
+};
+
+static size_t _nodepool_slab_capacity(const NodePool pool) {
+    return (SLAB_BYTES - sizeof (struct _nodeslab)) / pool->node_size;
+}
+
+static NodeSlab _nodepool_slab_of(void* node) {
+    return (NodeSlab) ((uintptr_t) node & ~(uintptr_t) (SLAB_BYTES - 1));
+}
+
+static bool _nodepool_slab_full(const NodeSlab slab) {
+    return !slab->free_nodes && !slab->unused;
+}
+
+static void _nodepool_link(NodePool pool, NodeSlab slab) {
+    slab->prev = NULL;
+    slab->next = pool->partial;
+
+    if (pool->partial)  pool->partial->prev = slab;
+    else                pool->partial_tail = slab;
+    pool->partial = slab;
+}
+
+static void _nodepool_unlink(NodePool pool, NodeSlab slab) {
+    if (slab->prev) slab->prev->next = slab->next;
+    else            pool->partial = slab->next;
+
+    if (slab->next) slab->next->prev = slab->prev;
+    else            pool->partial_tail = slab->prev;
+}
+
+static NodeSlab _nodepool_add_slab(NodePool pool) {
+    NodeSlab slab = pool->spare ? pool->spare : (NodeSlab) aligned_alloc(SLAB_BYTES, SLAB_BYTES);
+    if (!slab) return NULL;
+
+    pool->spare = NULL;
+    slab->owner = pool;
+    slab->free_nodes = NULL;
+    slab->bump = (char*) slab->nodes;
+    slab->unused = _nodepool_slab_capacity(pool);
+    slab->live = 0;
+
+    _nodepool_link(pool, slab);
+    pool->free_count += slab->unused;
+    pool->slabs++;
+    return slab;
+}
+
+// One empty slab is kept back, so a list that keeps emptying and refilling does not go to malloc every time
+static void _nodepool_retire(NodePool pool, NodeSlab slab) {
+    _nodepool_unlink(pool, slab);
+    pool->free_count -= _nodepool_slab_capacity(pool);
+    pool->slabs--;
+
+    if (pool->spare || pool->detached)  free(slab);
+    else                                pool->spare = slab;
+
+    if (pool->detached && pool->slabs == 0) free(pool);
+}
+
+NodePool _nodepool_new(size_t node_size) {
+    NodePool new_pool = (NodePool) malloc(sizeof (struct _nodepool));
+    if (!new_pool) return NULL;
+
+    *new_pool = (struct _nodepool) {.node_size = node_size < sizeof (void*) ? sizeof (void*) : node_size};
+    return new_pool;
+}
+
+void* _nodepool_alloc(NodePool pool) {
+    NodeSlab slab = pool->partial ? pool->partial : _nodepool_add_slab(pool);
+    if (!slab) return NULL;
+
+    void* node = slab->free_nodes;
+    if (node) {
+        slab->free_nodes = *(void**) node;
+    } else {
+        node = slab->bump;
+        slab->bump += pool->node_size;
+        slab->unused--;
+    }
+
+    slab->live++;
+    pool->free_count--;
+    if (_nodepool_slab_full(slab)) _nodepool_unlink(pool, slab);
+    return node;
+}
+
+// Makes sure the next count allocations cannot fail
+bool _nodepool_reserve(NodePool pool, size_t count) {
+    while (pool->free_count < count) {
+        if (!_nodepool_add_slab(pool)) return false;
+    }
+    return true;
+}
+
+// The node goes back to the pool that carved it, which may belong to another list after a splice or split
+void _nodepool_free(void* node) {
+    NodeSlab slab = _nodepool_slab_of(node);
+    NodePool pool = slab->owner;
+    if (_nodepool_slab_full(slab)) _nodepool_link(pool, slab);
+
+    *(void**) node = slab->free_nodes;
+    slab->free_nodes = node;
+    slab->live--;
+    pool->free_count++;
+
+    if (slab->live == 0) _nodepool_retire(pool, slab);
+}
+
+// Gives the kept-back empty slab to the system once the list is not expected to refill
+void _nodepool_release(NodePool pool) {
+    free(pool->spare);
+    pool->spare = NULL;
+}
+
+// Called once the list has given back all of its nodes; slabs still holding nodes of other lists keep the pool alive
+void _nodepool_destroy(NodePool pool) {
+    _nodepool_release(pool);
+    pool->detached = true;
+    if (pool->slabs == 0) free(pool);
+}
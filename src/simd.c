@@ -0,0 +1,457 @@
+#include "internal/simd.h"
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86
+#endif
+
+typedef struct {
+    long long (*sum_int)(const int* arr, size_t size);
+    int (*min_int)(const int* arr, size_t size);
+    int (*max_int)(const int* arr, size_t size);
+    size_t (*count_int)(const int* arr, size_t size, int target);
+    size_t (*find_int)(const int* arr, size_t size, int target);
+    bool (*equals_int)(const int* arr1, const int* arr2, size_t size);
+    size_t (*count_byte)(const char* arr, size_t size, char target);
+    size_t (*find_byte)(const char* arr, size_t size, char target);
+} SimdKernels;
+
+// Scalar kernels are kept out of the auto-vectorizer so they remain a true baseline on every target
+#define SCALAR_KERNEL __attribute__((optimize("no-tree-vectorize")))
+
+SCALAR_KERNEL static long long _simd_scalar_sum_int(const int* arr, size_t size) {
+    long long sum = 0;
+    for (size_t i = 0; i < size; i++) sum += arr[i];
+    return sum;
+}
+
+SCALAR_KERNEL static int _simd_scalar_min_int(const int* arr, size_t size) {
+    int min = arr[0];
+    for (size_t i = 1; i < size; i++) if (arr[i] < min) min = arr[i];
+    return min;
+}
+
+SCALAR_KERNEL static int _simd_scalar_max_int(const int* arr, size_t size) {
+    int max = arr[0];
+    for (size_t i = 1; i < size; i++) if (arr[i] > max) max = arr[i];
+    return max;
+}
+
+SCALAR_KERNEL static size_t _simd_scalar_count_int(const int* arr, size_t size, int target) {
+    size_t freq = 0;
+    for (size_t i = 0; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+SCALAR_KERNEL static size_t _simd_scalar_find_int(const int* arr, size_t size, int target) {
+    for (size_t i = 0; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+SCALAR_KERNEL static bool _simd_scalar_equals_int(const int* arr1, const int* arr2, size_t size) {
+    for (size_t i = 0; i < size; i++) if (arr1[i] != arr2[i]) return false;
+    return true;
+}
+
+SCALAR_KERNEL static size_t _simd_scalar_count_byte(const char* arr, size_t size, char target) {
+    size_t freq = 0;
+    for (size_t i = 0; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+SCALAR_KERNEL static size_t _simd_scalar_find_byte(const char* arr, size_t size, char target) {
+    for (size_t i = 0; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+#ifdef SIMD_X86
+
+#define SSE2_KERNEL __attribute__((target("sse2")))
+#define AVX2_KERNEL __attribute__((target("avx2,popcnt")))
+#define AVX512_KERNEL __attribute__((target("avx512f,avx512bw,popcnt")))
+
+#define COUNT_BLOCK (1 << 20)
+
+SSE2_KERNEL static long long _simd_sse2_sum_int(const int* arr, size_t size) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        // SSE2 has no sign extension instruction, so interleave each lane with its sign mask instead
+        __m128i v = _mm_loadu_si128((const __m128i*) (arr + i));
+        __m128i sign = _mm_srai_epi32(v, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+    }
+
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*) lanes, acc);
+    long long sum = lanes[0] + lanes[1];
+    for (; i < size; i++) sum += arr[i];
+    return sum;
+}
+
+SSE2_KERNEL static int _simd_sse2_min_int(const int* arr, size_t size) {
+    int min = arr[0];
+    size_t i = 0;
+    if (size >= 4) {
+        __m128i acc = _mm_loadu_si128((const __m128i*) arr);
+        for (i = 4; i + 4 <= size; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*) (arr + i));
+            __m128i gt = _mm_cmpgt_epi32(acc, v);
+            acc = _mm_or_si128(_mm_and_si128(gt, v), _mm_andnot_si128(gt, acc));
+        }
+
+        int lanes[4];
+        _mm_storeu_si128((__m128i*) lanes, acc);
+        for (int j = 0; j < 4; j++) if (lanes[j] < min) min = lanes[j];
+    }
+    for (; i < size; i++) if (arr[i] < min) min = arr[i];
+    return min;
+}
+
+SSE2_KERNEL static int _simd_sse2_max_int(const int* arr, size_t size) {
+    int max = arr[0];
+    size_t i = 0;
+    if (size >= 4) {
+        __m128i acc = _mm_loadu_si128((const __m128i*) arr);
+        for (i = 4; i + 4 <= size; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*) (arr + i));
+            __m128i gt = _mm_cmpgt_epi32(v, acc);
+            acc = _mm_or_si128(_mm_and_si128(gt, v), _mm_andnot_si128(gt, acc));
+        }
+
+        int lanes[4];
+        _mm_storeu_si128((__m128i*) lanes, acc);
+        for (int j = 0; j < 4; j++) if (lanes[j] > max) max = lanes[j];
+    }
+    for (; i < size; i++) if (arr[i] > max) max = arr[i];
+    return max;
+}
+
+SSE2_KERNEL static size_t _simd_sse2_count_int(const int* arr, size_t size, int target) {
+    __m128i needle = _mm_set1_epi32(target);
+    size_t freq = 0, i = 0;
+    while (i + 4 <= size) {
+        // Matches are all-ones lanes, so subtracting them counts per lane; flushed before a lane can overflow
+        __m128i acc = _mm_setzero_si128();
+        for (size_t block = 0; block < COUNT_BLOCK && i + 4 <= size; block++, i += 4) {
+            acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) (arr + i)), needle));
+        }
+
+        unsigned int lanes[4];
+        _mm_storeu_si128((__m128i*) lanes, acc);
+        freq += (size_t) lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    for (; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+SSE2_KERNEL static size_t _simd_sse2_find_int(const int* arr, size_t size, int target) {
+    __m128i needle = _mm_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) (arr + i)), needle);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    for (; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+SSE2_KERNEL static bool _simd_sse2_equals_int(const int* arr1, const int* arr2, size_t size) {
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) (arr1 + i)), _mm_loadu_si128((const __m128i*) (arr2 + i)));
+        if (_mm_movemask_epi8(eq) != 0xFFFF) return false;
+    }
+    for (; i < size; i++) if (arr1[i] != arr2[i]) return false;
+    return true;
+}
+
+SSE2_KERNEL static size_t _simd_sse2_count_byte(const char* arr, size_t size, char target) {
+    __m128i needle = _mm_set1_epi8(target);
+    size_t freq = 0, i = 0;
+    while (i + 16 <= size) {
+        // Byte lanes saturate after 255 blocks, then a sum of absolute differences folds them into two 64-bit lanes
+        __m128i acc = _mm_setzero_si128();
+        for (int block = 0; block < 255 && i + 16 <= size; block++, i += 16) {
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (arr + i)), needle));
+        }
+
+        long long lanes[2];
+        _mm_storeu_si128((__m128i*) lanes, _mm_sad_epu8(acc, _mm_setzero_si128()));
+        freq += lanes[0] + lanes[1];
+    }
+    for (; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+SSE2_KERNEL static size_t _simd_sse2_find_byte(const char* arr, size_t size, char target) {
+    __m128i needle = _mm_set1_epi8(target);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (arr + i)), needle);
+        int mask = _mm_movemask_epi8(eq);
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    for (; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+AVX2_KERNEL static long long _simd_avx2_sum_int(const int* arr, size_t size) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) (arr + i))));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) (arr + i + 4))));
+    }
+
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i*) lanes, acc);
+    long long sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < size; i++) sum += arr[i];
+    return sum;
+}
+
+AVX2_KERNEL static int _simd_avx2_min_int(const int* arr, size_t size) {
+    int min = arr[0];
+    size_t i = 0;
+    if (size >= 8) {
+        __m256i acc = _mm256_loadu_si256((const __m256i*) arr);
+        for (i = 8; i + 8 <= size; i += 8) acc = _mm256_min_epi32(acc, _mm256_loadu_si256((const __m256i*) (arr + i)));
+
+        int lanes[8];
+        _mm256_storeu_si256((__m256i*) lanes, acc);
+        for (int j = 0; j < 8; j++) if (lanes[j] < min) min = lanes[j];
+    }
+    for (; i < size; i++) if (arr[i] < min) min = arr[i];
+    return min;
+}
+
+AVX2_KERNEL static int _simd_avx2_max_int(const int* arr, size_t size) {
+    int max = arr[0];
+    size_t i = 0;
+    if (size >= 8) {
+        __m256i acc = _mm256_loadu_si256((const __m256i*) arr);
+        for (i = 8; i + 8 <= size; i += 8) acc = _mm256_max_epi32(acc, _mm256_loadu_si256((const __m256i*) (arr + i)));
+
+        int lanes[8];
+        _mm256_storeu_si256((__m256i*) lanes, acc);
+        for (int j = 0; j < 8; j++) if (lanes[j] > max) max = lanes[j];
+    }
+    for (; i < size; i++) if (arr[i] > max) max = arr[i];
+    return max;
+}
+
+AVX2_KERNEL static size_t _simd_avx2_count_int(const int* arr, size_t size, int target) {
+    __m256i needle = _mm256_set1_epi32(target);
+    size_t freq = 0, i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (arr + i)), needle);
+        freq += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+    }
+    for (; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+AVX2_KERNEL static size_t _simd_avx2_find_int(const int* arr, size_t size, int target) {
+    __m256i needle = _mm256_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (arr + i)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    for (; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+AVX2_KERNEL static bool _simd_avx2_equals_int(const int* arr1, const int* arr2, size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (arr1 + i)), _mm256_loadu_si256((const __m256i*) (arr2 + i)));
+        if ((uint32_t) _mm256_movemask_epi8(eq) != UINT32_MAX) return false;
+    }
+    for (; i < size; i++) if (arr1[i] != arr2[i]) return false;
+    return true;
+}
+
+AVX2_KERNEL static size_t _simd_avx2_count_byte(const char* arr, size_t size, char target) {
+    __m256i needle = _mm256_set1_epi8(target);
+    size_t freq = 0, i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (arr + i)), needle);
+        freq += __builtin_popcount((uint32_t) _mm256_movemask_epi8(eq));
+    }
+    for (; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+AVX2_KERNEL static size_t _simd_avx2_find_byte(const char* arr, size_t size, char target) {
+    __m256i needle = _mm256_set1_epi8(target);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (arr + i)), needle);
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(eq);
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    for (; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+AVX512_KERNEL static long long _simd_avx512_sum_int(const int* arr, size_t size) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        acc = _mm512_add_epi64(acc, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*) (arr + i))));
+        acc = _mm512_add_epi64(acc, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*) (arr + i + 8))));
+    }
+
+    long long sum = _mm512_reduce_add_epi64(acc);
+    for (; i < size; i++) sum += arr[i];
+    return sum;
+}
+
+AVX512_KERNEL static int _simd_avx512_min_int(const int* arr, size_t size) {
+    int min = arr[0];
+    size_t i = 0;
+    if (size >= 16) {
+        __m512i acc = _mm512_loadu_si512(arr);
+        for (i = 16; i + 16 <= size; i += 16) acc = _mm512_min_epi32(acc, _mm512_loadu_si512(arr + i));
+        min = _mm512_reduce_min_epi32(acc);
+    }
+    for (; i < size; i++) if (arr[i] < min) min = arr[i];
+    return min;
+}
+
+AVX512_KERNEL static int _simd_avx512_max_int(const int* arr, size_t size) {
+    int max = arr[0];
+    size_t i = 0;
+    if (size >= 16) {
+        __m512i acc = _mm512_loadu_si512(arr);
+        for (i = 16; i + 16 <= size; i += 16) acc = _mm512_max_epi32(acc, _mm512_loadu_si512(arr + i));
+        max = _mm512_reduce_max_epi32(acc);
+    }
+    for (; i < size; i++) if (arr[i] > max) max = arr[i];
+    return max;
+}
+
+AVX512_KERNEL static size_t _simd_avx512_count_int(const int* arr, size_t size, int target) {
+    __m512i needle = _mm512_set1_epi32(target);
+    size_t freq = 0, i = 0;
+    for (; i + 16 <= size; i += 16) freq += __builtin_popcount(_mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arr + i), needle));
+    for (; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+AVX512_KERNEL static size_t _simd_avx512_find_int(const int* arr, size_t size, int target) {
+    __m512i needle = _mm512_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arr + i), needle);
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    for (; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+AVX512_KERNEL static bool _simd_avx512_equals_int(const int* arr1, const int* arr2, size_t size) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        if (_mm512_cmpneq_epi32_mask(_mm512_loadu_si512(arr1 + i), _mm512_loadu_si512(arr2 + i))) return false;
+    }
+    for (; i < size; i++) if (arr1[i] != arr2[i]) return false;
+    return true;
+}
+
+AVX512_KERNEL static size_t _simd_avx512_count_byte(const char* arr, size_t size, char target) {
+    __m512i needle = _mm512_set1_epi8(target);
+    size_t freq = 0, i = 0;
+    for (; i + 64 <= size; i += 64) freq += __builtin_popcountll(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(arr + i), needle));
+    for (; i < size; i++) freq += arr[i] == target;
+    return freq;
+}
+
+AVX512_KERNEL static size_t _simd_avx512_find_byte(const char* arr, size_t size, char target) {
+    __m512i needle = _mm512_set1_epi8(target);
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        __mmask64 mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(arr + i), needle);
+        if (mask) return i + __builtin_ctzll(mask);
+    }
+    for (; i < size; i++) if (arr[i] == target) return i;
+    return size;
+}
+
+#endif // SIMD_X86
+
+#define KERNELS(isa) { \
+    _simd_##isa##_sum_int, _simd_##isa##_min_int, _simd_##isa##_max_int, _simd_##isa##_count_int, \
+    _simd_##isa##_find_int, _simd_##isa##_equals_int, _simd_##isa##_count_byte, _simd_##isa##_find_byte \
+}
+
+static const SimdKernels _simd_tables[] = {
+    [SIMD_SCALAR] = KERNELS(scalar),
+#ifdef SIMD_X86
+    [SIMD_SSE2] = KERNELS(sse2),
+    [SIMD_AVX2] = KERNELS(avx2),
+    [SIMD_AVX512] = KERNELS(avx512),
+#endif
+};
+
+static const char* _simd_names[] = {
+    [SIMD_SCALAR] = "scalar",
+    [SIMD_SSE2] = "sse2",
+    [SIMD_AVX2] = "avx2",
+    [SIMD_AVX512] = "avx512",
+};
+
+static SimdKernels _simd_kernels = KERNELS(scalar);
+static SimdLevel _simd_current = SIMD_SCALAR;
+
+static bool _simd_supported(SimdLevel level) {
+    switch (level) {
+        case SIMD_SCALAR: return true;
+#ifdef SIMD_X86
+        case SIMD_SSE2: return __builtin_cpu_supports("sse2");
+        case SIMD_AVX2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+        case SIMD_AVX512: return _simd_supported(SIMD_AVX2) && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+        default: return false;
+    }
+}
+
+__attribute__((constructor)) static void _simd_init(void) {
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+#endif
+    for (SimdLevel level = SIMD_AVX512; level > SIMD_SCALAR; level--) {
+        if (_simd_select(level)) return;
+    }
+}
+
+SimdLevel _simd_level(void) {
+    return _simd_current;
+}
+
+bool _simd_select(SimdLevel level) {
+    if (!_simd_supported(level)) return false;
+
+    _simd_kernels = _simd_tables[level];
+    _simd_current = level;
+    return true;
+}
+
+const char* _simd_level_name(SimdLevel level) {
+    return level <= SIMD_AVX512 ? _simd_names[level] : "unknown";
+}
+
+long long _simd_sum_int(const int* arr, size_t size) { return _simd_kernels.sum_int(arr, size); }
+int _simd_min_int(const int* arr, size_t size) { return _simd_kernels.min_int(arr, size); }
+int _simd_max_int(const int* arr, size_t size) { return _simd_kernels.max_int(arr, size); }
+size_t _simd_count_int(const int* arr, size_t size, int target) { return _simd_kernels.count_int(arr, size, target); }
+size_t _simd_find_int(const int* arr, size_t size, int target) { return _simd_kernels.find_int(arr, size, target); }
+bool _simd_equals_int(const int* arr1, const int* arr2, size_t size) { return _simd_kernels.equals_int(arr1, arr2, size); }
+size_t _simd_count_byte(const char* arr, size_t size, char target) { return _simd_kernels.count_byte(arr, size, target); }
+size_t _simd_find_byte(const char* arr, size_t size, char target) { return _simd_kernels.find_byte(arr, size, target); }
@@ -0,0 +1,76 @@
+#include "internal/textio.h"
+#include <string.h>
+
+// Two digits per lookup halves the number of divisions
+static const char _textio_digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+size_t _textio_format_int(int value, char* out) {
+    // Widened before negating, so INT_MIN needs no special case
+    unsigned int magnitude = value < 0 ? -(unsigned int) value : (unsigned int) value;
+
+    char digits[10];
+    size_t pos = sizeof (digits);
+    while (magnitude >= 100) {
+        unsigned int pair = (magnitude % 100) * 2;
+        magnitude /= 100;
+        digits[--pos] = _textio_digit_pairs[pair + 1];
+        digits[--pos] = _textio_digit_pairs[pair];
+    }
+    if (magnitude >= 10) {
+        digits[--pos] = _textio_digit_pairs[magnitude * 2 + 1];
+        digits[--pos] = _textio_digit_pairs[magnitude * 2];
+    } else {
+        digits[--pos] = (char) ('0' + magnitude);
+    }
+
+    size_t length = 0;
+    if (value < 0) out[length++] = '-';
+    memcpy(out + length, digits + pos, sizeof (digits) - pos);
+    return length + sizeof (digits) - pos;
+}
+
+void _textio_writer_init(TextWriter* writer, FILE* stream) {
+    writer->stream = stream;
+    writer->used = 0;
+    writer->ok = true;
+}
+
+static void _textio_drain(TextWriter* writer) {
+    if (writer->used > 0 && fwrite(writer->data, 1, writer->used, writer->stream) != writer->used) writer->ok = false;
+    writer->used = 0;
+}
+
+void _textio_write(TextWriter* writer, const char* data, size_t size) {
+    if (writer->used + size > TEXTIO_BUFFER_SIZE) {
+        _textio_drain(writer);
+
+        // Anything that would not fit even in an empty buffer goes straight through
+        if (size > TEXTIO_BUFFER_SIZE) {
+            if (fwrite(data, 1, size, writer->stream) != size) writer->ok = false;
+            return;
+        }
+    }
+
+    memcpy(writer->data + writer->used, data, size);
+    writer->used += size;
+}
+
+void _textio_write_int(TextWriter* writer, int value) {
+    if (writer->used + TEXTIO_INT_MAX_LEN > TEXTIO_BUFFER_SIZE) _textio_drain(writer);
+    writer->used += _textio_format_int(value, writer->data + writer->used);
+}
+
+bool _textio_flush(TextWriter* writer) {
+    _textio_drain(writer);
+    return writer->ok && fflush(writer->stream) == 0;
+}
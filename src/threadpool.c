@@ -0,0 +1,123 @@
+#include "internal/threadpool.h"
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_WORKERS 63
+#define CHUNKS_PER_THREAD 4
+
+// Library-owned workers, started on first use; the submitting thread works alongside them
+typedef struct _threadpool {
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    pthread_t workers[MAX_WORKERS];
+    size_t workers_num;
+    unsigned long generation;
+    size_t active;
+    bool stopping;
+    void (*task)(void* arg, size_t index);
+    void* arg;
+    size_t tasks;
+    atomic_size_t next_task;
+} ThreadPool;
+
+static ThreadPool _threadpool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work_ready = PTHREAD_COND_INITIALIZER,
+    .work_done = PTHREAD_COND_INITIALIZER,
+};
+static pthread_once_t _threadpool_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t _threadpool_submit = PTHREAD_MUTEX_INITIALIZER;
+
+// Set on pool threads and while a submitter helps out, so nested parallel calls run inline instead of deadlocking
+static _Thread_local bool _threadpool_inside = false;
+
+static void _threadpool_drain(void (*task)(void* arg, size_t index), void* arg, size_t tasks) {
+    for (size_t index; (index = atomic_fetch_add(&_threadpool.next_task, 1)) < tasks; ) task(arg, index);
+}
+
+static void* _threadpool_worker(void* unused) {
+    _threadpool_inside = true;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&_threadpool.lock);
+    while (true) {
+        while (!_threadpool.stopping && _threadpool.generation == seen) pthread_cond_wait(&_threadpool.work_ready, &_threadpool.lock);
+        if (_threadpool.stopping) break;
+
+        seen = _threadpool.generation;
+        void (*task)(void* arg, size_t index) = _threadpool.task;
+        void* arg = _threadpool.arg;
+        size_t tasks = _threadpool.tasks;
+        pthread_mutex_unlock(&_threadpool.lock);
+
+        _threadpool_drain(task, arg, tasks);
+
+        pthread_mutex_lock(&_threadpool.lock);
+        if (--_threadpool.active == 0) pthread_cond_signal(&_threadpool.work_done);
+    }
+    pthread_mutex_unlock(&_threadpool.lock);
+    return NULL;
+}
+
+static void _threadpool_start(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t wanted = cpus > 1 ? (size_t) cpus - 1 : 0;
+    if (wanted > MAX_WORKERS) wanted = MAX_WORKERS;
+
+    // Running with fewer workers than wanted is fine, the submitter covers whatever is left
+    while (_threadpool.workers_num < wanted) {
+        if (pthread_create(&_threadpool.workers[_threadpool.workers_num], NULL, _threadpool_worker, NULL) != 0) break;
+        _threadpool.workers_num++;
+    }
+}
+
+__attribute__((destructor)) static void _threadpool_stop(void) {
+    pthread_mutex_lock(&_threadpool.lock);
+    _threadpool.stopping = true;
+    pthread_cond_broadcast(&_threadpool.work_ready);
+    pthread_mutex_unlock(&_threadpool.lock);
+
+    for (size_t i = 0; i < _threadpool.workers_num; i++) pthread_join(_threadpool.workers[i], NULL);
+    _threadpool.workers_num = 0;
+}
+
+size_t _threadpool_threads(void) {
+    pthread_once(&_threadpool_once, _threadpool_start);
+    return _threadpool.workers_num + 1;
+}
+
+size_t _threadpool_chunks(size_t size) {
+    size_t chunks = _threadpool_threads() * CHUNKS_PER_THREAD;
+    if (size / chunks < PAR_MIN_CHUNK) chunks = size / PAR_MIN_CHUNK;
+    return chunks > 0 ? chunks : 1;
+}
+
+void _threadpool_run(void (*task)(void* arg, size_t index), void* arg, size_t tasks) {
+    if (_threadpool_threads() == 1 || _threadpool_inside || tasks < 2) {
+        for (size_t i = 0; i < tasks; i++) task(arg, i);
+        return;
+    }
+
+    pthread_mutex_lock(&_threadpool_submit);
+    pthread_mutex_lock(&_threadpool.lock);
+    _threadpool.task = task;
+    _threadpool.arg = arg;
+    _threadpool.tasks = tasks;
+    atomic_store(&_threadpool.next_task, 0);
+    _threadpool.active = _threadpool.workers_num;
+    _threadpool.generation++;
+    pthread_cond_broadcast(&_threadpool.work_ready);
+    pthread_mutex_unlock(&_threadpool.lock);
+
+    _threadpool_inside = true;
+    _threadpool_drain(task, arg, tasks);
+    _threadpool_inside = false;
+
+    pthread_mutex_lock(&_threadpool.lock);
+    while (_threadpool.active > 0) pthread_cond_wait(&_threadpool.work_done, &_threadpool.lock);
+    pthread_mutex_unlock(&_threadpool.lock);
+    pthread_mutex_unlock(&_threadpool_submit);
+}
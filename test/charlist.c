@@ -0,0 +1,183 @@
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <ctype.h>
+#include "linkedlist/charlist.h"
+
+TEST(new) {
+    CharList list = charlist_new();
+    ASSERT_NOT_NULL(list);
+
+    ASSERT_TRUE(charlist_is_empty(list));
+    ASSERT_EQUAL(charlist_size(list), 0);
+    ASSERT_NULL(charlist_to_string(list));
+}
+
+TEST(append_str) {
+    CharList list = charlist_new();
+    ASSERT_NOT_NULL(list);
+
+    ASSERT_TRUE(charlist_append_str(list, "hello"));
+    ASSERT_TRUE(charlist_append_str(list, ""));
+    ASSERT_TRUE(charlist_append_str(list, ", world"));
+    ASSERT_EQUAL(charlist_size(list), 12);
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "hello, world"), 0);
+
+    char value;
+    ASSERT_TRUE(charlist_back(list, &value));
+    ASSERT_EQUAL(value, 'd');
+
+    // Appended nodes link up with ones pushed one at a time on both sides
+    ASSERT_TRUE(charlist_push_front(list, '>'));
+    ASSERT_TRUE(charlist_push(list, '!'));
+    ASSERT_TRUE(charlist_append_str(list, "?"));
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), ">hello, world!?"), 0);
+
+    ASSERT_FALSE(charlist_append_str(list, NULL));
+    ASSERT_FALSE(charlist_append_str(NULL, "abc"));
+    ASSERT_EQUAL(charlist_size(list), 15);
+}
+
+TEST(sort) {
+    CharList list = charlist_new();
+    ASSERT_NOT_NULL(list);
+
+    // Counting sort must follow char ordering, so on targets where char is signed the negative values come first
+    char values[] = {'b', 0, CHAR_MAX, 'a', (char) -5, CHAR_MIN, 'b', (char) -5, 1};
+    for (size_t i = 0; i < sizeof (values); i++) ASSERT_TRUE(charlist_push(list, values[i]));
+    charlist_sort(list);
+    ASSERT_EQUAL(charlist_size(list), sizeof (values));
+
+    bool sorted = true;
+    char prev, curr;
+    ASSERT_TRUE(charlist_front(list, &prev));
+    for (size_t i = 1; i < sizeof (values); i++, prev = curr) sorted = sorted && charlist_get_at(list, i, &curr) && prev <= curr;
+    ASSERT_TRUE(sorted);
+
+    ASSERT_TRUE(charlist_front(list, &curr));
+    ASSERT_EQUAL(curr, CHAR_MIN);
+    ASSERT_TRUE(charlist_back(list, &curr));
+    ASSERT_EQUAL(curr, CHAR_MAX);
+    ASSERT_EQUAL(charlist_count(list, (char) -5), 2);
+    ASSERT_EQUAL(charlist_count(list, 'b'), 2);
+
+    charlist_sort(NULL);
+}
+
+TEST(sort_by) {
+    CharList list = charlist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(charlist_append_str(list, "bAcaBdCb"));
+
+    int compare_ignoring_case(char a, char b, void* ctx) {
+        (void) ctx;
+        return tolower((unsigned char) a) - tolower((unsigned char) b);
+    }
+
+    // Equal keys must keep their original relative order
+    charlist_sort_by(list, compare_ignoring_case, NULL);
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "AabBbcCd"), 0);
+
+    int descending(char a, char b, void* ctx) {
+        (void) ctx;
+        return b - a;
+    }
+
+    charlist_sort_by(list, descending, NULL);
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "dcbbaCBA"), 0);
+
+    // Without a comparator it falls back to the natural order
+    charlist_sort_by(list, NULL, NULL);
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "ABCabbcd"), 0);
+}
+
+TEST(splice_concat) {
+    CharList list = charlist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(charlist_append_str(list, "cd"));
+
+    CharList other = charlist_new();
+    ASSERT_TRUE(charlist_append_str(other, "ab"));
+    ASSERT_TRUE(charlist_splice(list, 0, other));
+    ASSERT_TRUE(charlist_is_empty(other));
+
+    ASSERT_TRUE(charlist_append_str(other, "XY"));
+    ASSERT_TRUE(charlist_splice(list, 2, other));
+    ASSERT_TRUE(charlist_append_str(other, "ef"));
+    ASSERT_TRUE(charlist_splice(list, charlist_size(list), other));
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "abXYcdef"), 0);
+
+    // The emptied source stays usable and can be concatenated again
+    ASSERT_TRUE(charlist_push(other, 'g'));
+    ASSERT_TRUE(charlist_concat(list, other));
+    ASSERT_TRUE(charlist_is_empty(other));
+    ASSERT_TRUE(charlist_concat(list, other));
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "abXYcdefg"), 0);
+
+    char value;
+    ASSERT_TRUE(charlist_back(list, &value));
+    ASSERT_EQUAL(value, 'g');
+
+    // A list cannot be spliced into itself, and nothing may change when it is rejected
+    ASSERT_FALSE(charlist_splice(list, 1, list));
+    ASSERT_FALSE(charlist_concat(list, list));
+    ASSERT_FALSE(charlist_splice(list, charlist_size(list) + 1, other));
+    ASSERT_FALSE(charlist_splice(NULL, 0, other));
+    ASSERT_FALSE(charlist_concat(list, NULL));
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "abXYcdefg"), 0);
+}
+
+TEST(split_at) {
+    CharList list = charlist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(charlist_append_str(list, "abcdefgh"));
+
+    // Splitting at the end leaves everything in place; splitting at 0 moves everything
+    CharList rest = charlist_split_at(list, charlist_size(list));
+    ASSERT_NOT_NULL(rest);
+    ASSERT_TRUE(charlist_is_empty(rest));
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "abcdefgh"), 0);
+
+    rest = charlist_split_at(list, 0);
+    ASSERT_NOT_NULL(rest);
+    ASSERT_TRUE(charlist_is_empty(list));
+    ASSERT_EQUAL(strcmp(charlist_to_string(rest), "abcdefgh"), 0);
+
+    // Split points near either end, so both the front and the back get moved
+    CharList tail = charlist_split_at(rest, 6);
+    ASSERT_EQUAL(strcmp(charlist_to_string(rest), "abcdef"), 0);
+    ASSERT_EQUAL(strcmp(charlist_to_string(tail), "gh"), 0);
+
+    CharList middle = charlist_split_at(rest, 2);
+    ASSERT_EQUAL(strcmp(charlist_to_string(rest), "ab"), 0);
+    ASSERT_EQUAL(strcmp(charlist_to_string(middle), "cdef"), 0);
+
+    // Both halves keep working on their own
+    ASSERT_TRUE(charlist_push(rest, '1'));
+    ASSERT_TRUE(charlist_push_front(middle, '2'));
+    charlist_pop(tail);
+    ASSERT_TRUE(charlist_concat(list, middle));
+    ASSERT_TRUE(charlist_concat(list, rest));
+    ASSERT_TRUE(charlist_concat(list, tail));
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "2cdefab1g"), 0);
+
+    ASSERT_NULL(charlist_split_at(list, charlist_size(list) + 1));
+    ASSERT_NULL(charlist_split_at(NULL, 0));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"append_str", test_append_str},
+        {"sort", test_sort},
+        {"sort_by", test_sort_by},
+        {"splice and concat", test_splice_concat},
+        {"split_at", test_split_at},
+    };
+
+    TestSuite suite = {.name = "CharList", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#include "queue/charqueue.h"
+#include "linkedlist/charlist.h"
+#include "stack/charstack.h"
+
+TEST(new) {
+    CharQueue queue = charqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    ASSERT_TRUE(charqueue_is_empty(queue));
+    ASSERT_EQUAL(charqueue_size(queue), 0);
+    ASSERT_FALSE(charqueue_is_full(queue));
+
+    char value;
+    ASSERT_FALSE(charqueue_peek(queue, &value));
+    ASSERT_FALSE(charqueue_dequeue(queue, &value));
+}
+
+TEST(wrap_around) {
+    CharQueue queue = charqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    // Moving the head forward first makes the ring wrap while there is still room, then grow while wrapped
+    for (int i = 0; i < 10; i++) ASSERT_TRUE(charqueue_enqueue(queue, 'x'));
+    for (int i = 0; i < 10; i++) ASSERT_TRUE(charqueue_dequeue(queue, NULL));
+
+    for (int i = 0; i < 16; i++) ASSERT_TRUE(charqueue_enqueue(queue, 'a' + i));
+    ASSERT_EQUAL(charqueue_capacity(queue), 16);
+    for (int i = 16; i < 26; i++) ASSERT_TRUE(charqueue_enqueue(queue, 'a' + i));
+    ASSERT_EQUAL(charqueue_capacity(queue), 32);
+    ASSERT_EQUAL(charqueue_size(queue), 26);
+
+    char value;
+    ASSERT_TRUE(charqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 'a');
+
+    bool in_order = true;
+    for (int i = 0; i < 26; i++) in_order = in_order && charqueue_dequeue(queue, &value) && value == 'a' + i;
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(charqueue_is_empty(queue));
+
+    ASSERT_FALSE(charqueue_enqueue(NULL, 'a'));
+}
+
+TEST(bounded) {
+    CharQueue queue = charqueue_new_bounded(10);
+    ASSERT_NOT_NULL(queue);
+    ASSERT_EQUAL(charqueue_capacity(queue), 10);
+
+    for (int i = 0; i < 10; i++) ASSERT_TRUE(charqueue_enqueue(queue, '0' + i));
+    ASSERT_TRUE(charqueue_is_full(queue));
+    ASSERT_FALSE(charqueue_enqueue(queue, 'x'));
+    ASSERT_EQUAL(charqueue_size(queue), 10);
+
+    char value;
+    ASSERT_TRUE(charqueue_dequeue(queue, &value));
+    ASSERT_EQUAL(value, '0');
+    ASSERT_FALSE(charqueue_is_full(queue));
+    ASSERT_TRUE(charqueue_enqueue(queue, 'x'));
+    ASSERT_FALSE(charqueue_enqueue(queue, 'y'));
+
+    ASSERT_NULL(charqueue_new_bounded(0));
+}
+
+TEST(clear) {
+    CharQueue queue = charqueue_new_bounded(4);
+    ASSERT_NOT_NULL(queue);
+
+    for (int i = 0; i < 4; i++) ASSERT_TRUE(charqueue_enqueue(queue, 'a' + i));
+    charqueue_clear(queue);
+    ASSERT_TRUE(charqueue_is_empty(queue));
+    ASSERT_FALSE(charqueue_is_full(queue));
+    ASSERT_EQUAL(charqueue_size(queue), 0);
+
+    // Clearing keeps the bound
+    for (int i = 0; i < 4; i++) ASSERT_TRUE(charqueue_enqueue(queue, 'e' + i));
+    ASSERT_FALSE(charqueue_enqueue(queue, 'x'));
+
+    char value;
+    ASSERT_TRUE(charqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 'e');
+
+    charqueue_clear(NULL);
+}
+
+TEST(conversions) {
+    CharQueue queue = charqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    for (int i = 0; i < 12; i++) ASSERT_TRUE(charqueue_enqueue(queue, '-'));
+    for (int i = 0; i < 12; i++) ASSERT_TRUE(charqueue_dequeue(queue, NULL));
+    for (int i = 0; i < 8; i++) ASSERT_TRUE(charqueue_enqueue(queue, 'a' + i));
+
+    // The front of the queue becomes the head of the list and the bottom of the stack
+    CharList list = charqueue_to_list(queue);
+    ASSERT_NOT_NULL(list);
+    ASSERT_EQUAL(strcmp(charlist_to_string(list), "abcdefgh"), 0);
+
+    CharStack stack = charqueue_to_stack(queue);
+    ASSERT_NOT_NULL(stack);
+    ASSERT_EQUAL(charstack_size(stack), 8);
+
+    bool in_order = true;
+    char value;
+    for (int i = 7; i >= 0; i--) in_order = in_order && charstack_pop(stack, &value) && value == 'a' + i;
+    ASSERT_TRUE(in_order);
+
+    // Converting copies, so the queue keeps its values
+    ASSERT_EQUAL(charqueue_size(queue), 8);
+    ASSERT_TRUE(charlist_is_empty(charqueue_to_list(charqueue_new())));
+    ASSERT_NULL(charqueue_to_stack(NULL));
+}
+
+TEST(count_contains) {
+    CharQueue queue = charqueue_new();
+    ASSERT_NOT_NULL(queue);
+    ASSERT_EQUAL(charqueue_count(queue, 'a'), 0);
+    ASSERT_FALSE(charqueue_contains(queue, 'a'));
+
+    // Fill a 256-slot ring starting past its middle, so the values sit in two runs
+    for (int i = 0; i < 200; i++) ASSERT_TRUE(charqueue_enqueue(queue, 'x'));
+    for (int i = 0; i < 200; i++) ASSERT_TRUE(charqueue_dequeue(queue, NULL));
+    for (int i = 0; i < 150; i++) ASSERT_TRUE(charqueue_enqueue(queue, i % 3 == 0 ? 'a' : 'b'));
+    ASSERT_TRUE(charqueue_enqueue(queue, 'z'));
+    ASSERT_EQUAL(charqueue_capacity(queue), 256);
+
+    ASSERT_EQUAL(charqueue_count(queue, 'a'), 50);
+    ASSERT_EQUAL(charqueue_count(queue, 'b'), 100);
+    ASSERT_TRUE(charqueue_contains(queue, 'z'));
+    ASSERT_FALSE(charqueue_contains(queue, 'x'));
+
+    ASSERT_EQUAL(charqueue_count(NULL, 'a'), 0);
+    ASSERT_FALSE(charqueue_contains(NULL, 'a'));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"wrap around", test_wrap_around},
+        {"bounded", test_bounded},
+        {"clear", test_clear},
+        {"conversions", test_conversions},
+        {"count and contains", test_count_contains},
+    };
+
+    TestSuite suite = {.name = "CharQueue", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
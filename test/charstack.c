@@ -65,6 +65,24 @@ TEST(push) {
     ASSERT_FALSE(charstack_push(NULL, 'Y'));
 }
 
+TEST(reserve) {
+    CharStack stack = charstack_new();
+    ASSERT_NOT_NULL(stack);
+    ASSERT_EQUAL(charstack_capacity(stack), 0);
+
+    ASSERT_TRUE(charstack_reserve(stack, 64));
+    ASSERT_EQUAL(charstack_capacity(stack), 64);
+
+    // Clearing keeps the storage, so refilling up to the reserved size never grows it
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 64; i++) ASSERT_TRUE(charstack_push(stack, 'a' + i % 26));
+        charstack_clear(stack);
+        ASSERT_TRUE(charstack_is_empty(stack));
+    }
+    ASSERT_EQUAL(charstack_capacity(stack), 64);
+    ASSERT_FALSE(charstack_reserve(NULL, 1));
+}
+
 TEST(pop) {
     CharStack stack = charstack_new();
     ASSERT_NOT_NULL(stack);
@@ -162,15 +180,39 @@ TEST(size) {
     ASSERT_EQUAL(charstack_size(NULL), 0);
 }
 
+TEST(count_contains) {
+    CharStack stack = charstack_new();
+    ASSERT_NOT_NULL(stack);
+    ASSERT_EQUAL(charstack_count(stack, 'a'), 0);
+    ASSERT_FALSE(charstack_contains(stack, 'a'));
+
+    // Long enough for the vector loops, with a tail the scalar remainder has to cover
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(charstack_push(stack, i % 10 == 0 ? 'a' : 'b'));
+    ASSERT_TRUE(charstack_push(stack, 'z'));
+
+    ASSERT_EQUAL(charstack_count(stack, 'a'), 100);
+    ASSERT_EQUAL(charstack_count(stack, 'b'), 900);
+    ASSERT_TRUE(charstack_contains(stack, 'z'));
+    ASSERT_FALSE(charstack_contains(stack, 'c'));
+
+    ASSERT_TRUE(charstack_pop(stack, NULL));
+    ASSERT_FALSE(charstack_contains(stack, 'z'));
+
+    ASSERT_EQUAL(charstack_count(NULL, 'a'), 0);
+    ASSERT_FALSE(charstack_contains(NULL, 'a'));
+}
+
 int main() {
     TestCase tests[] = {
         {"new", test_new},
         {"is_empty", test_is_empty},
         {"clear", test_clear},
         {"push", test_push},
+        {"reserve", test_reserve},
         {"pop", test_pop},
         {"peek", test_peek},
         {"size", test_size},
+        {"count and contains", test_count_contains},
     };
 
     TestSuite suite = {.name = "CharStack", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
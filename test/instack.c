@@ -66,6 +66,48 @@ TEST(push) {
     ASSERT_FALSE(intstack_push(NULL, 20));
 }
 
+TEST(push_n) {
+    IntStack stack = intstack_new();
+    ASSERT_NOT_NULL(stack);
+
+    int arr[] = {10, 20, 30};
+    ASSERT_TRUE(intstack_push_n(stack, arr, 3));
+    ASSERT_TRUE(intstack_push_n(stack, NULL, 0));
+    ASSERT_FALSE(intstack_push_n(stack, NULL, 3));
+    ASSERT_EQUAL(intstack_size(stack), 3);
+
+    // The last element of the array ends up on top
+    int top_value;
+    for (int i = 2; i >= 0; i--) {
+        ASSERT_TRUE(intstack_pop(stack, &top_value));
+        ASSERT_EQUAL(top_value, arr[i]);
+    }
+
+    ASSERT_FALSE(intstack_push_n(NULL, arr, 3));
+}
+
+TEST(reserve) {
+    IntStack stack = intstack_new();
+    ASSERT_NOT_NULL(stack);
+    ASSERT_EQUAL(intstack_capacity(stack), 0);
+
+    ASSERT_TRUE(intstack_reserve(stack, 100));
+    ASSERT_EQUAL(intstack_capacity(stack), 100);
+    ASSERT_TRUE(intstack_reserve(stack, 10));
+    ASSERT_EQUAL(intstack_capacity(stack), 100);
+
+    // Clearing keeps the storage, so refilling up to the reserved size never grows it
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 100; i++) ASSERT_TRUE(intstack_push(stack, i));
+        intstack_clear(stack);
+        ASSERT_TRUE(intstack_is_empty(stack));
+    }
+    ASSERT_EQUAL(intstack_capacity(stack), 100);
+
+    ASSERT_TRUE(intstack_push(stack, 1));
+    ASSERT_FALSE(intstack_reserve(NULL, 1));
+}
+
 TEST(pop) {
     IntStack stack = intstack_new();
     ASSERT_NOT_NULL(stack);
@@ -169,6 +211,8 @@ int main() {
         {"is_empty", test_is_empty},
         {"clear", test_clear},
         {"push", test_push},
+        {"push_n", test_push_n},
+        {"reserve", test_reserve},
         {"pop", test_pop},
         {"peek", test_peek},
         {"size", test_size},
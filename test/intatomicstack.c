@@ -0,0 +1,109 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "stack/intatomicstack.h"
+
+TEST(new) {
+    IntAtomicStack stack = intatomicstack_new();
+    ASSERT_NOT_NULL(stack);
+    ASSERT_TRUE(intatomicstack_is_empty(stack));
+
+    int value;
+    ASSERT_FALSE(intatomicstack_pop(stack, &value));
+    ASSERT_FALSE(intatomicstack_push(NULL, 1));
+}
+
+TEST(lifo_order) {
+    IntAtomicStack stack = intatomicstack_new();
+    ASSERT_NOT_NULL(stack);
+
+    // Enough values to spill over several node chunks, popped and pushed again to reuse the freed nodes
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 10000; i++) ASSERT_TRUE(intatomicstack_push(stack, i));
+
+        int value;
+        for (int i = 9999; i >= 0; i--) {
+            ASSERT_TRUE(intatomicstack_pop(stack, &value));
+            ASSERT_EQUAL(value, i);
+        }
+        ASSERT_TRUE(intatomicstack_is_empty(stack));
+    }
+}
+
+TEST(push_n) {
+    IntAtomicStack stack = intatomicstack_new();
+    ASSERT_NOT_NULL(stack);
+
+    int arr[] = {1, 2, 3, 4, 5};
+    ASSERT_TRUE(intatomicstack_push(stack, 0));
+    ASSERT_TRUE(intatomicstack_push_n(stack, arr, 5));
+    ASSERT_TRUE(intatomicstack_push_n(stack, NULL, 0));
+    ASSERT_FALSE(intatomicstack_push_n(stack, NULL, 3));
+
+    int value;
+    for (int i = 5; i >= 0; i--) {
+        ASSERT_TRUE(intatomicstack_pop(stack, &value));
+        ASSERT_EQUAL(value, i);
+    }
+    ASSERT_FALSE(intatomicstack_pop(stack, &value));
+}
+
+TEST(shared_id_pool) {
+    enum { THREADS = 4, IDS = 1000, ROUNDS = 100000 };
+    IntAtomicStack pool = intatomicstack_new();
+    ASSERT_NOT_NULL(pool);
+
+    int ids[IDS];
+    for (int i = 0; i < IDS; i++) ids[i] = i;
+    ASSERT_TRUE(intatomicstack_push_n(pool, ids, IDS));
+
+    // Every thread borrows a few ids at a time and hands them back, so pushes and pops contend on the same top
+    atomic_int owners[IDS];
+    for (int i = 0; i < IDS; i++) atomic_init(&owners[i], 0);
+    atomic_bool exclusive = true;
+
+    void* borrow(void* arg) {
+        int held[8];
+        for (int round = 0; round < ROUNDS / 8; round++) {
+            int count = 0;
+            while (count < 8 && intatomicstack_pop(pool, &held[count])) {
+                if (atomic_fetch_add(&owners[held[count]], 1) != 0) atomic_store(&exclusive, false);
+                count++;
+            }
+            for (int i = 0; i < count; i++) {
+                atomic_fetch_sub(&owners[held[i]], 1);
+                intatomicstack_push(pool, held[i]);
+            }
+        }
+        return NULL;
+    }
+
+    pthread_t threads[THREADS];
+    for (int i = 0; i < THREADS; i++) ASSERT_EQUAL(pthread_create(&threads[i], NULL, borrow, NULL), 0);
+    for (int i = 0; i < THREADS; i++) pthread_join(threads[i], NULL);
+    ASSERT_TRUE(atomic_load(&exclusive));
+
+    bool seen[IDS] = {false};
+    int value, count = 0;
+    while (intatomicstack_pop(pool, &value)) {
+        ASSERT_TRUE(value >= 0 && value < IDS && !seen[value]);
+        seen[value] = true;
+        count++;
+    }
+    ASSERT_EQUAL(count, IDS);
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"lifo order", test_lifo_order},
+        {"push_n", test_push_n},
+        {"shared id pool", test_shared_id_pool},
+    };
+
+    TestSuite suite = {.name = "IntAtomicStack", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
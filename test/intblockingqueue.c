@@ -0,0 +1,129 @@
+#include "test.h"
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include "queue/intblockingqueue.h"
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+TEST(new) {
+    IntBlockingQueue queue = intblockingqueue_new();
+    ASSERT_NOT_NULL(queue);
+    ASSERT_TRUE(intblockingqueue_is_empty(queue));
+    ASSERT_FALSE(intblockingqueue_is_closed(queue));
+
+    IntBlockingQueue bounded = intblockingqueue_new_bounded(4);
+    ASSERT_NOT_NULL(bounded);
+    ASSERT_EQUAL(intblockingqueue_capacity(bounded), 4);
+    ASSERT_NULL(intblockingqueue_new_bounded(0));
+}
+
+TEST(timed_waits) {
+    IntBlockingQueue queue = intblockingqueue_new_bounded(2);
+    ASSERT_NOT_NULL(queue);
+
+    int value;
+    ASSERT_FALSE(intblockingqueue_dequeue_timed(queue, &value, 0));
+
+    double start = now();
+    ASSERT_FALSE(intblockingqueue_dequeue_timed(queue, &value, 30));
+    ASSERT_TRUE(now() - start >= 0.025);
+
+    ASSERT_TRUE(intblockingqueue_enqueue(queue, 1));
+    ASSERT_TRUE(intblockingqueue_enqueue_timed(queue, 2, 0));
+    ASSERT_FALSE(intblockingqueue_enqueue_timed(queue, 3, 30));
+    ASSERT_EQUAL(intblockingqueue_size(queue), 2);
+
+    ASSERT_TRUE(intblockingqueue_dequeue_timed(queue, &value, 30));
+    ASSERT_EQUAL(value, 1);
+    ASSERT_TRUE(intblockingqueue_dequeue(queue, NULL));
+}
+
+TEST(close) {
+    IntBlockingQueue queue = intblockingqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    // A consumer blocked on an empty queue is released by close instead of waiting forever
+    void* wait_forever(void* arg) {
+        int value;
+        *(bool*) arg = intblockingqueue_dequeue(queue, &value);
+        return NULL;
+    }
+
+    bool got = true;
+    pthread_t consumer;
+    ASSERT_EQUAL(pthread_create(&consumer, NULL, wait_forever, &got), 0);
+    struct timespec pause = {.tv_sec = 0, .tv_nsec = 20000000};
+    nanosleep(&pause, NULL);
+    intblockingqueue_close(queue);
+    pthread_join(consumer, NULL);
+    ASSERT_FALSE(got);
+    ASSERT_TRUE(intblockingqueue_is_closed(queue));
+
+    // Values already queued are still handed out after close, new ones are refused
+    IntBlockingQueue draining = intblockingqueue_new();
+    ASSERT_TRUE(intblockingqueue_enqueue(draining, 1) && intblockingqueue_enqueue(draining, 2));
+    intblockingqueue_close(draining);
+    ASSERT_FALSE(intblockingqueue_enqueue(draining, 3));
+
+    int buf[4];
+    ASSERT_EQUAL(intblockingqueue_dequeue_batch(draining, buf, 4, -1), 2);
+    ASSERT_EQUAL(buf[1], 2);
+    ASSERT_EQUAL(intblockingqueue_dequeue_batch(draining, buf, 4, -1), 0);
+}
+
+TEST(producers_and_consumers) {
+    enum { THREADS = 3, PER_PRODUCER = 50000 };
+    IntBlockingQueue queue = intblockingqueue_new_bounded(64);
+    ASSERT_NOT_NULL(queue);
+
+    void* produce(void* arg) {
+        for (int i = 0; i < PER_PRODUCER; i++) intblockingqueue_enqueue(queue, 1);
+        return NULL;
+    }
+    // Consumers drain in batches until the queue is closed and empty
+    void* consume(void* arg) {
+        int buf[32];
+        long long sum = 0;
+        for (size_t got; (got = intblockingqueue_dequeue_batch(queue, buf, 32, -1)) > 0; ) {
+            for (size_t i = 0; i < got; i++) sum += buf[i];
+        }
+        *(long long*) arg = sum;
+        return NULL;
+    }
+
+    pthread_t producers[THREADS], consumers[THREADS];
+    long long sums[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        ASSERT_EQUAL(pthread_create(&producers[i], NULL, produce, NULL), 0);
+        ASSERT_EQUAL(pthread_create(&consumers[i], NULL, consume, &sums[i]), 0);
+    }
+    for (int i = 0; i < THREADS; i++) pthread_join(producers[i], NULL);
+    intblockingqueue_close(queue);
+
+    long long total = 0;
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(consumers[i], NULL);
+        total += sums[i];
+    }
+    ASSERT_EQUAL(total, THREADS * PER_PRODUCER);
+    ASSERT_TRUE(intblockingqueue_is_empty(queue));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"timed waits", test_timed_waits},
+        {"close", test_close},
+        {"producers and consumers", test_producers_and_consumers},
+    };
+
+    TestSuite suite = {.name = "IntBlockingQueue", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
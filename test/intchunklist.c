@@ -0,0 +1,209 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist/intchunklist.h"
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+
+TEST(new) {
+    IntChunkList list = intchunklist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(intchunklist_is_empty(list));
+    ASSERT_EQUAL(intchunklist_size(list), 0);
+
+    int value;
+    ASSERT_FALSE(intchunklist_front(list, &value) || intchunklist_back(list, &value));
+}
+
+TEST(push_and_pop_ends) {
+    IntChunkList list = intchunklist_new();
+    ASSERT_NOT_NULL(list);
+
+    // Enough elements to span several chunks on both sides
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(intchunklist_push(list, i));
+        ASSERT_TRUE(intchunklist_push_front(list, -i - 1));
+    }
+    ASSERT_EQUAL(intchunklist_size(list), 200);
+
+    int value;
+    for (int i = 0; i < 200; i++) {
+        ASSERT_TRUE(intchunklist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, i - 100);
+    }
+
+    ASSERT_TRUE(intchunklist_front(list, &value));
+    ASSERT_EQUAL(value, -100);
+    ASSERT_TRUE(intchunklist_back(list, &value));
+    ASSERT_EQUAL(value, 99);
+
+    intchunklist_pop_front(list);
+    intchunklist_pop(list);
+    ASSERT_TRUE(intchunklist_front(list, &value));
+    ASSERT_EQUAL(value, -99);
+    ASSERT_TRUE(intchunklist_back(list, &value));
+    ASSERT_EQUAL(value, 98);
+    ASSERT_EQUAL(intchunklist_size(list), 198);
+
+    while (!intchunklist_is_empty(list)) intchunklist_pop(list);
+    ASSERT_EQUAL(intchunklist_size(list), 0);
+    ASSERT_FALSE(intchunklist_push(NULL, 1));
+    ASSERT_FALSE(intchunklist_push_front(NULL, 1));
+}
+
+TEST(push_at_and_pop_at) {
+    IntChunkList list = intchunklist_new();
+    IntList reference = intlist_new();
+    ASSERT_NOT_NULL(list && reference);
+
+    ASSERT_FALSE(intchunklist_push_at(list, 1, 1));
+
+    // Random positional edits, mirrored on an IntList, exercise chunk splitting and merging
+    srand(42);
+    for (int i = 0; i < 2000; i++) {
+        size_t size = intchunklist_size(list);
+        if (size > 0 && rand() % 3 == 0) {
+            size_t index = rand() % size;
+            intchunklist_pop_at(list, index);
+            intlist_pop_at(reference, index);
+        } else {
+            size_t index = rand() % (size + 1);
+            ASSERT_TRUE(intchunklist_push_at(list, i, index));
+            ASSERT_TRUE(intlist_push_at(reference, i, index));
+        }
+    }
+
+    ASSERT_EQUAL(intchunklist_size(list), intlist_size(reference));
+
+    int value, expected;
+    for (size_t i = 0; i < intlist_size(reference); i++) {
+        ASSERT_TRUE(intchunklist_get_at(list, i, &value));
+        ASSERT_TRUE(intlist_get_at(reference, i, &expected));
+        ASSERT_EQUAL(expected, value);
+    }
+
+    ASSERT_TRUE(intlist_equals(intchunklist_to_list(list), reference));
+    ASSERT_FALSE(intchunklist_get_at(list, intchunklist_size(list), &value));
+}
+
+TEST(search) {
+    int arr[] = {5, 3, 8, 3, 9, 3, 1};
+    IntChunkList list = intchunklist_from_array(arr, 7);
+    ASSERT_NOT_NULL(list);
+
+    ASSERT_EQUAL(intchunklist_index(list, 3), 1);
+    ASSERT_EQUAL(intchunklist_index(list, 1), 6);
+    ASSERT_EQUAL(intchunklist_index(list, 42), -1);
+    ASSERT_EQUAL(intchunklist_count(list, 3), 3);
+    ASSERT_TRUE(intchunklist_contains(list, 9));
+    ASSERT_FALSE(intchunklist_contains(list, 42));
+    ASSERT_FALSE(intchunklist_contains(NULL, 9));
+}
+
+TEST(equals) {
+    IntChunkList list1 = intchunklist_new();
+    IntChunkList list2 = intchunklist_new();
+    ASSERT_NOT_NULL(list1 && list2);
+    ASSERT_TRUE(intchunklist_equals(list1, list2));
+
+    // Same values laid out in differently filled chunks
+    for (int i = 0; i < 50; i++) ASSERT_TRUE(intchunklist_push(list1, i));
+    for (int i = 49; i >= 0; i--) ASSERT_TRUE(intchunklist_push_front(list2, i));
+    ASSERT_TRUE(intchunklist_equals(list1, list2));
+
+    intchunklist_pop_at(list2, 20);
+    ASSERT_TRUE(intchunklist_push_at(list2, -1, 20));
+    ASSERT_FALSE(intchunklist_equals(list1, list2));
+    ASSERT_FALSE(intchunklist_equals(list1, NULL));
+}
+
+TEST(reverse) {
+    IntChunkList list = intchunklist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 0; i < 37; i++) ASSERT_TRUE(intchunklist_push(list, i));
+    intchunklist_reverse(list);
+
+    int value;
+    for (int i = 0; i < 37; i++) {
+        ASSERT_TRUE(intchunklist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, 36 - i);
+    }
+}
+
+TEST(functional) {
+    IntChunkList list = intchunklist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 1; i <= 1000; i++) ASSERT_TRUE(intchunklist_push(list, i));
+    ASSERT_EQUAL(intchunklist_sum(list), 500500);
+
+    int twice(int num) { return num * 2; }
+    bool is_even(int num) { return num % 2 == 0; }
+
+    IntChunkList doubled = intchunklist_map(list, twice);
+    ASSERT_NOT_NULL(doubled);
+    ASSERT_EQUAL(intchunklist_sum(doubled), 1001000);
+    ASSERT_TRUE(intchunklist_all(doubled, is_even));
+
+    IntChunkList evens = intchunklist_filter(list, is_even);
+    ASSERT_NOT_NULL(evens);
+    ASSERT_EQUAL(intchunklist_size(evens), 500);
+    ASSERT_FALSE(intchunklist_any(intchunklist_filter(evens, NULL), NULL));
+
+    IntChunkList copy = intchunklist_copy(list);
+    ASSERT_TRUE(intchunklist_equals(copy, list));
+
+    int* arr = intchunklist_to_array(list);
+    ASSERT_NOT_NULL(arr);
+    for (int i = 0; i < 1000; i++) ASSERT_EQUAL(arr[i], i + 1);
+
+    IntChunkList zipped = intchunklist_zip(list, evens);
+    ASSERT_EQUAL(intchunklist_size(zipped), 1000);
+}
+
+TEST(conversions) {
+    IntChunkList list = intchunklist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(intlist_is_empty(intchunklist_to_list(list)));
+    ASSERT_TRUE(intstack_is_empty(intchunklist_to_stack(list)));
+    ASSERT_TRUE(intqueue_is_empty(intchunklist_to_queue(list)));
+
+    // Not a whole number of batches or chunks, so the last partial one is copied too
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(intchunklist_push(list, i));
+
+    IntList copy = intchunklist_to_list(list);
+    IntStack stack = intchunklist_to_stack(list);
+    IntQueue queue = intchunklist_to_queue(list);
+    ASSERT_EQUAL(intlist_size(copy), 1000);
+    ASSERT_EQUAL(intstack_size(stack), 1000);
+    ASSERT_EQUAL(intqueue_size(queue), 1000);
+
+    bool in_order = true;
+    int value;
+    for (int i = 0; i < 1000; i++) in_order = in_order && intlist_get_at(copy, i, &value) && value == i;
+    for (int i = 999; i >= 0; i--) in_order = in_order && intstack_pop(stack, &value) && value == i;
+    for (int i = 0; i < 1000; i++) in_order = in_order && intqueue_dequeue(queue, &value) && value == i;
+    ASSERT_TRUE(in_order);
+
+    ASSERT_NULL(intchunklist_to_list(NULL));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"push and pop ends", test_push_and_pop_ends},
+        {"push_at and pop_at", test_push_at_and_pop_at},
+        {"search", test_search},
+        {"equals", test_equals},
+        {"reverse", test_reverse},
+        {"functional", test_functional},
+        {"conversions", test_conversions},
+    };
+
+    TestSuite suite = {.name = "IntChunkList", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist/intcompactlist.h"
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+
+TEST(new) {
+    IntCompactList list = intcompactlist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(intcompactlist_is_empty(list));
+    ASSERT_EQUAL(intcompactlist_size(list), 0);
+    ASSERT_EQUAL(intcompactlist_capacity(list), 0);
+
+    int value;
+    ASSERT_FALSE(intcompactlist_front(list, &value) || intcompactlist_back(list, &value));
+
+    IntCompactList reserved = intcompactlist_with_capacity(100);
+    ASSERT_NOT_NULL(reserved);
+    ASSERT_EQUAL(intcompactlist_capacity(reserved), 100);
+}
+
+TEST(push_and_pop_ends) {
+    IntCompactList list = intcompactlist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(intcompactlist_push(list, i));
+        ASSERT_TRUE(intcompactlist_push_front(list, -i - 1));
+    }
+    ASSERT_EQUAL(intcompactlist_size(list), 200);
+
+    int value;
+    for (int i = 0; i < 200; i++) {
+        ASSERT_TRUE(intcompactlist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, i - 100);
+    }
+
+    intcompactlist_pop_front(list);
+    intcompactlist_pop(list);
+    ASSERT_TRUE(intcompactlist_front(list, &value));
+    ASSERT_EQUAL(value, -99);
+    ASSERT_TRUE(intcompactlist_back(list, &value));
+    ASSERT_EQUAL(value, 98);
+
+    while (!intcompactlist_is_empty(list)) intcompactlist_pop(list);
+    ASSERT_EQUAL(intcompactlist_size(list), 0);
+    ASSERT_FALSE(intcompactlist_push(NULL, 1));
+}
+
+TEST(push_at_and_pop_at) {
+    IntCompactList list = intcompactlist_new();
+    IntList reference = intlist_new();
+    ASSERT_NOT_NULL(list && reference);
+
+    ASSERT_FALSE(intcompactlist_push_at(list, 1, 1));
+
+    // Random positional edits, mirrored on an IntList, interleave arena growth with freelist reuse
+    srand(42);
+    for (int i = 0; i < 2000; i++) {
+        size_t size = intcompactlist_size(list);
+        if (size > 0 && rand() % 3 == 0) {
+            size_t index = rand() % size;
+            intcompactlist_pop_at(list, index);
+            intlist_pop_at(reference, index);
+        } else {
+            size_t index = rand() % (size + 1);
+            ASSERT_TRUE(intcompactlist_push_at(list, i, index));
+            ASSERT_TRUE(intlist_push_at(reference, i, index));
+        }
+    }
+
+    ASSERT_TRUE(intlist_equals(intcompactlist_to_list(list), reference));
+    ASSERT_TRUE(intcompactlist_set_at(list, 0, -1));
+    intlist_pop_front(reference);
+    ASSERT_TRUE(intlist_push_front(reference, -1));
+
+    // Compacting renumbers every node but must keep the sequence intact
+    ASSERT_TRUE(intcompactlist_shrink_to_fit(list));
+    ASSERT_EQUAL(intcompactlist_capacity(list), intlist_size(reference));
+    ASSERT_TRUE(intlist_equals(intcompactlist_to_list(list), reference));
+    ASSERT_TRUE(intcompactlist_push_front(list, 7));
+    ASSERT_TRUE(intcompactlist_push(list, 8));
+    ASSERT_EQUAL(intcompactlist_size(list), intlist_size(reference) + 2);
+
+    int value;
+    ASSERT_FALSE(intcompactlist_get_at(list, intcompactlist_size(list), &value));
+}
+
+TEST(reuse_and_clear) {
+    IntCompactList list = intcompactlist_with_capacity(64);
+    ASSERT_NOT_NULL(list);
+
+    // Released slots are handed out again before the arena grows
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < 64; i++) ASSERT_TRUE(intcompactlist_push(list, i));
+        for (int i = 0; i < 64; i++) intcompactlist_pop_front(list);
+    }
+    ASSERT_EQUAL(intcompactlist_capacity(list), 64);
+
+    for (int i = 0; i < 10; i++) ASSERT_TRUE(intcompactlist_push(list, i));
+    intcompactlist_clear(list);
+    ASSERT_TRUE(intcompactlist_is_empty(list));
+    ASSERT_EQUAL(intcompactlist_capacity(list), 64);
+
+    ASSERT_TRUE(intcompactlist_shrink_to_fit(list));
+    ASSERT_EQUAL(intcompactlist_capacity(list), 0);
+    ASSERT_TRUE(intcompactlist_push(list, 1));
+    ASSERT_FALSE(intcompactlist_reserve(NULL, 1));
+}
+
+TEST(search_and_equals) {
+    int arr[] = {5, 3, 8, 3, 9, 3, 1};
+    IntCompactList list = intcompactlist_from_array(arr, 7);
+    ASSERT_NOT_NULL(list);
+
+    ASSERT_EQUAL(intcompactlist_index(list, 3), 1);
+    ASSERT_EQUAL(intcompactlist_index(list, 42), -1);
+    ASSERT_EQUAL(intcompactlist_count(list, 3), 3);
+    ASSERT_TRUE(intcompactlist_contains(list, 9));
+    ASSERT_FALSE(intcompactlist_contains(list, 42));
+
+    IntCompactList copy = intcompactlist_copy(list);
+    ASSERT_TRUE(intcompactlist_equals(list, copy));
+    ASSERT_TRUE(intcompactlist_set_at(copy, 6, 2));
+    ASSERT_FALSE(intcompactlist_equals(list, copy));
+    ASSERT_FALSE(intcompactlist_equals(list, NULL));
+
+    intcompactlist_reverse(list);
+    int value;
+    for (int i = 0; i < 7; i++) {
+        ASSERT_TRUE(intcompactlist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, arr[6 - i]);
+    }
+}
+
+TEST(functional) {
+    IntCompactList list = intcompactlist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 1; i <= 1000; i++) ASSERT_TRUE(intcompactlist_push(list, i));
+    ASSERT_EQUAL(intcompactlist_sum(list), 500500);
+
+    int twice(int num) { return num * 2; }
+    bool is_even(int num) { return num % 2 == 0; }
+    long long add(long long acc, int value) { return acc + value; }
+
+    IntCompactList doubled = intcompactlist_map(list, twice);
+    ASSERT_EQUAL(intcompactlist_reduce(doubled, add, 0), 1001000);
+    ASSERT_TRUE(intcompactlist_all(doubled, is_even));
+
+    IntCompactList evens = intcompactlist_filter(list, is_even);
+    ASSERT_EQUAL(intcompactlist_size(evens), 500);
+    ASSERT_FALSE(intcompactlist_any(evens, NULL));
+
+    int* arr = intcompactlist_to_array(list);
+    ASSERT_NOT_NULL(arr);
+    for (int i = 0; i < 1000; i++) ASSERT_EQUAL(arr[i], i + 1);
+
+    ASSERT_EQUAL(intcompactlist_size(intcompactlist_zip(list, evens)), 1000);
+
+    intcompactlist_foreach(list, twice);
+    ASSERT_TRUE(intcompactlist_equals(list, doubled));
+}
+
+TEST(conversions) {
+    IntCompactList list = intcompactlist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(intlist_is_empty(intcompactlist_to_list(list)));
+    ASSERT_TRUE(intstack_is_empty(intcompactlist_to_stack(list)));
+    ASSERT_TRUE(intqueue_is_empty(intcompactlist_to_queue(list)));
+
+    // Not a whole number of batches or chunks, so the last partial one is copied too
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(intcompactlist_push(list, i));
+
+    IntList copy = intcompactlist_to_list(list);
+    IntStack stack = intcompactlist_to_stack(list);
+    IntQueue queue = intcompactlist_to_queue(list);
+    ASSERT_EQUAL(intlist_size(copy), 1000);
+    ASSERT_EQUAL(intstack_size(stack), 1000);
+    ASSERT_EQUAL(intqueue_size(queue), 1000);
+
+    bool in_order = true;
+    int value;
+    for (int i = 0; i < 1000; i++) in_order = in_order && intlist_get_at(copy, i, &value) && value == i;
+    for (int i = 999; i >= 0; i--) in_order = in_order && intstack_pop(stack, &value) && value == i;
+    for (int i = 0; i < 1000; i++) in_order = in_order && intqueue_dequeue(queue, &value) && value == i;
+    ASSERT_TRUE(in_order);
+
+    ASSERT_NULL(intcompactlist_to_list(NULL));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"push and pop ends", test_push_and_pop_ends},
+        {"push_at and pop_at", test_push_at_and_pop_at},
+        {"reuse and clear", test_reuse_and_clear},
+        {"search and equals", test_search_and_equals},
+        {"functional", test_functional},
+        {"conversions", test_conversions},
+    };
+
+    TestSuite suite = {.name = "IntCompactList", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
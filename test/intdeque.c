@@ -0,0 +1,168 @@
+#include "test.h"
+#include <stdio.h>
+#include "queue/intdeque.h"
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+
+TEST(new) {
+    IntDeque deque = intdeque_new();
+    ASSERT_NOT_NULL(deque);
+    ASSERT_TRUE(intdeque_is_empty(deque));
+    ASSERT_EQUAL(intdeque_size(deque), 0);
+
+    int value;
+    ASSERT_FALSE(intdeque_front(deque, &value) || intdeque_back(deque, &value));
+    ASSERT_FALSE(intdeque_pop_front(deque, &value) || intdeque_pop_back(deque, &value));
+    ASSERT_FALSE(intdeque_push_back(NULL, 1));
+}
+
+TEST(both_ends) {
+    IntDeque deque = intdeque_new();
+    ASSERT_NOT_NULL(deque);
+
+    // Enough values to need many blocks and several map re-centrings in both directions
+    for (int i = 0; i < 5000; i++) {
+        ASSERT_TRUE(intdeque_push_back(deque, i));
+        ASSERT_TRUE(intdeque_push_front(deque, -i - 1));
+    }
+    ASSERT_EQUAL(intdeque_size(deque), 10000);
+
+    int value;
+    for (size_t i = 0; i < 10000; i += 37) {
+        ASSERT_TRUE(intdeque_get_at(deque, i, &value));
+        ASSERT_EQUAL(value, (int) i - 5000);
+    }
+    ASSERT_FALSE(intdeque_get_at(deque, 10000, &value));
+
+    ASSERT_TRUE(intdeque_set_at(deque, 0, 42));
+    ASSERT_TRUE(intdeque_front(deque, &value));
+    ASSERT_EQUAL(value, 42);
+    ASSERT_TRUE(intdeque_back(deque, &value));
+    ASSERT_EQUAL(value, 4999);
+
+    ASSERT_TRUE(intdeque_pop_front(deque, NULL));
+    for (int i = 4999; i >= -4999; i--) {
+        ASSERT_TRUE(intdeque_pop_back(deque, &value));
+        ASSERT_EQUAL(value, i);
+    }
+    ASSERT_TRUE(intdeque_is_empty(deque));
+}
+
+TEST(sliding_window) {
+    IntDeque deque = intdeque_new();
+    ASSERT_NOT_NULL(deque);
+
+    // The window keeps drifting right, so blocks are recycled from the front and the map re-centred, never grown
+    int value, next_out = 0;
+    for (int i = 0; i < 200000; i++) {
+        ASSERT_TRUE(intdeque_push_back(deque, i));
+        if (intdeque_size(deque) > 1000) {
+            ASSERT_TRUE(intdeque_pop_front(deque, &value));
+            ASSERT_EQUAL(value, next_out++);
+        }
+    }
+    ASSERT_EQUAL(intdeque_size(deque), 1000);
+    ASSERT_TRUE(intdeque_get_at(deque, 999, &value));
+    ASSERT_EQUAL(value, 199999);
+
+    // The same drift to the left
+    intdeque_clear(deque);
+    ASSERT_TRUE(intdeque_is_empty(deque));
+    for (int i = 0; i < 200000; i++) {
+        ASSERT_TRUE(intdeque_push_front(deque, i));
+        if (intdeque_size(deque) > 700) ASSERT_TRUE(intdeque_pop_back(deque, NULL));
+    }
+    ASSERT_TRUE(intdeque_back(deque, &value));
+    ASSERT_EQUAL(value, 199300);
+}
+
+TEST(bulk) {
+    int arr[3000];
+    for (int i = 0; i < 3000; i++) arr[i] = i;
+
+    IntDeque deque = intdeque_from_array(arr, 3000);
+    ASSERT_NOT_NULL(deque);
+    ASSERT_TRUE(intdeque_push_front(deque, -1));
+    ASSERT_TRUE(intdeque_push_back_n(deque, arr, 1000));
+    ASSERT_TRUE(intdeque_push_back_n(deque, NULL, 0));
+    ASSERT_FALSE(intdeque_push_back_n(deque, NULL, 3));
+    ASSERT_EQUAL(intdeque_size(deque), 4001);
+
+    int* values = intdeque_to_array(deque);
+    ASSERT_NOT_NULL(values);
+    ASSERT_EQUAL(values[0], -1);
+    for (int i = 0; i < 3000; i++) ASSERT_EQUAL(values[1 + i], i);
+    for (int i = 0; i < 1000; i++) ASSERT_EQUAL(values[3001 + i], i);
+
+    ASSERT_NULL(intdeque_from_array(NULL, 3));
+}
+
+TEST(conversions) {
+    int arr[] = {1, 2, 3, 4};
+    IntDeque deque = intdeque_from_array(arr, 4);
+    ASSERT_NOT_NULL(deque);
+
+    IntList list = intdeque_to_list(deque);
+    ASSERT_TRUE(intlist_equals(list, intlist_from_array(arr, 4)));
+
+    int value;
+    IntStack stack = intdeque_to_stack(deque);
+    ASSERT_TRUE(intstack_peek(stack, &value));
+    ASSERT_EQUAL(value, 4);
+
+    IntQueue queue = intdeque_to_queue(deque);
+    ASSERT_TRUE(intqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 1);
+
+    // Back again: lists and queues keep their order, a stack's top becomes the front
+    IntDeque from_list = intlist_to_deque(list);
+    IntDeque from_queue = intqueue_to_deque(queue);
+    IntDeque from_stack = intstack_to_deque(stack);
+    for (size_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(intdeque_get_at(from_list, i, &value));
+        ASSERT_EQUAL(value, arr[i]);
+        ASSERT_TRUE(intdeque_get_at(from_queue, i, &value));
+        ASSERT_EQUAL(value, arr[i]);
+        ASSERT_TRUE(intdeque_get_at(from_stack, i, &value));
+        ASSERT_EQUAL(value, arr[3 - i]);
+    }
+
+    ASSERT_TRUE(intdeque_is_empty(intlist_to_deque(intlist_new())));
+    ASSERT_NULL(intdeque_to_list(NULL));
+
+    // Enough values for several copy batches, the last one partial
+    IntStack big_stack = intstack_new();
+    IntList big_list = intlist_new();
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_TRUE(intstack_push(big_stack, i));
+        ASSERT_TRUE(intlist_push(big_list, i));
+    }
+
+    IntDeque big_from_stack = intstack_to_deque(big_stack);
+    IntDeque big_from_list = intlist_to_deque(big_list);
+    ASSERT_EQUAL(intdeque_size(big_from_stack), 1000);
+    ASSERT_EQUAL(intdeque_size(big_from_list), 1000);
+
+    bool in_order = true;
+    for (size_t i = 0; i < 1000; i++) {
+        in_order = in_order && intdeque_get_at(big_from_stack, i, &value) && value == 999 - (int) i;
+        in_order = in_order && intdeque_get_at(big_from_list, i, &value) && value == (int) i;
+    }
+    ASSERT_TRUE(in_order);
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"both ends", test_both_ends},
+        {"sliding window", test_sliding_window},
+        {"bulk", test_bulk},
+        {"conversions", test_conversions},
+    };
+
+    TestSuite suite = {.name = "IntDeque", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
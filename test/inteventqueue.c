@@ -0,0 +1,126 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include "queue/inteventqueue.h"
+
+static bool readable(int fd, int timeout_ms) {
+    struct pollfd pfd = {.fd = fd, .events = POLLIN};
+    return poll(&pfd, 1, timeout_ms) == 1 && (pfd.revents & POLLIN);
+}
+
+TEST(new) {
+    IntEventQueue queue = inteventqueue_new();
+    ASSERT_NOT_NULL(queue);
+    ASSERT_TRUE(inteventqueue_is_empty(queue));
+    ASSERT_TRUE(inteventqueue_fd(queue) >= 0);
+    ASSERT_FALSE(readable(inteventqueue_fd(queue), 0));
+
+    int value;
+    ASSERT_FALSE(inteventqueue_dequeue(queue, &value));
+    ASSERT_EQUAL(inteventqueue_fd(NULL), -1);
+    ASSERT_NULL(inteventqueue_new_bounded(0));
+}
+
+TEST(readiness) {
+    IntEventQueue queue = inteventqueue_new();
+    ASSERT_NOT_NULL(queue);
+    int fd = inteventqueue_fd(queue);
+
+    ASSERT_TRUE(inteventqueue_enqueue(queue, 1));
+    ASSERT_TRUE(readable(fd, 0));
+
+    // The first dequeue of a drain resets the eventfd, and values added mid-drain do not signal it again
+    int arr[] = {2, 3, 4};
+    ASSERT_TRUE(inteventqueue_enqueue_n(queue, arr, 3));
+    int value;
+    ASSERT_TRUE(inteventqueue_dequeue(queue, &value));
+    ASSERT_EQUAL(value, 1);
+    ASSERT_FALSE(readable(fd, 0));
+    ASSERT_TRUE(inteventqueue_enqueue(queue, 5));
+    ASSERT_FALSE(readable(fd, 0));
+
+    int out[8];
+    ASSERT_EQUAL(inteventqueue_dequeue_n(queue, out, 8), 4);
+    ASSERT_EQUAL(out[3], 5);
+    ASSERT_EQUAL(inteventqueue_dequeue_n(queue, out, 8), 0);
+    ASSERT_FALSE(readable(fd, 0));
+
+    // Once a drain has found the queue empty, the next value signals again
+    ASSERT_TRUE(inteventqueue_enqueue(queue, 6));
+    ASSERT_TRUE(readable(fd, 0));
+    ASSERT_TRUE(inteventqueue_dequeue(queue, &value));
+    ASSERT_FALSE(inteventqueue_dequeue(queue, &value));
+    ASSERT_FALSE(readable(fd, 0));
+}
+
+TEST(coalescing) {
+    IntEventQueue queue = inteventqueue_new();
+    ASSERT_NOT_NULL(queue);
+    int fd = inteventqueue_fd(queue);
+
+    // A whole burst only counts once on the eventfd
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(inteventqueue_enqueue(queue, i));
+    uint64_t count = 0;
+    ASSERT_EQUAL(read(fd, &count, sizeof (count)), sizeof (count));
+    ASSERT_EQUAL(count, 1);
+
+    int out[1000];
+    ASSERT_EQUAL(inteventqueue_dequeue_n(queue, out, 1000), 1000);
+    ASSERT_EQUAL(inteventqueue_dequeue_n(queue, out, 1000), 0);
+    ASSERT_FALSE(readable(fd, 0));
+    ASSERT_TRUE(inteventqueue_enqueue(queue, 1));
+    ASSERT_TRUE(readable(fd, 0));
+}
+
+TEST(epoll_loop) {
+    enum { HELPERS = 2, PER_HELPER = 20000 };
+    IntEventQueue queue = inteventqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    int epfd = epoll_create1(0);
+    ASSERT_TRUE(epfd >= 0);
+    struct epoll_event event = {.events = EPOLLIN, .data.fd = inteventqueue_fd(queue)};
+    ASSERT_EQUAL(epoll_ctl(epfd, EPOLL_CTL_ADD, inteventqueue_fd(queue), &event), 0);
+
+    void* help(void* arg) {
+        for (int i = 0; i < PER_HELPER; i++) inteventqueue_enqueue(queue, 1);
+        return NULL;
+    }
+
+    pthread_t helpers[HELPERS];
+    for (int i = 0; i < HELPERS; i++) ASSERT_EQUAL(pthread_create(&helpers[i], NULL, help, NULL), 0);
+
+    // The loop only ever wakes up through epoll, and drains everything on each wakeup
+    int received = 0, out[256];
+    while (received < HELPERS * PER_HELPER) {
+        struct epoll_event ready;
+        if (epoll_wait(epfd, &ready, 1, 1000) != 1) break;
+
+        for (size_t got; (got = inteventqueue_dequeue_n(queue, out, 256)) > 0; ) {
+            for (size_t i = 0; i < got; i++) received += out[i];
+        }
+    }
+    for (int i = 0; i < HELPERS; i++) pthread_join(helpers[i], NULL);
+    close(epfd);
+
+    ASSERT_EQUAL(received, HELPERS * PER_HELPER);
+    ASSERT_TRUE(inteventqueue_is_empty(queue));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"readiness", test_readiness},
+        {"coalescing", test_coalescing},
+        {"epoll loop", test_epoll_loop},
+    };
+
+    TestSuite suite = {.name = "IntEventQueue", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
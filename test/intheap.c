@@ -0,0 +1,132 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "heap/intheap.h"
+
+static int ascending(const void* a, const void* b) {
+    return (*(const int*) a > *(const int*) b) - (*(const int*) a < *(const int*) b);
+}
+
+TEST(new) {
+    IntHeap heap = intheap_new();
+    ASSERT_NOT_NULL(heap);
+    ASSERT_TRUE(intheap_is_empty(heap));
+    ASSERT_EQUAL(intheap_arity(heap), 4);
+
+    int value;
+    ASSERT_FALSE(intheap_peek(heap, &value));
+    ASSERT_FALSE(intheap_pop(heap, &value));
+
+    ASSERT_EQUAL(intheap_arity(intheap_with_arity(8, true)), 8);
+    ASSERT_NULL(intheap_with_arity(3, false));
+    ASSERT_NULL(intheap_with_arity(1, false));
+    ASSERT_NULL(intheap_with_arity(32, false));
+}
+
+TEST(push_and_pop) {
+    // Every supported arity must hand values back in sorted order, duplicates included
+    for (size_t arity = 2; arity <= 16; arity *= 2) {
+        IntHeap heap = intheap_with_arity(arity, false);
+        IntHeap max_heap = intheap_with_arity(arity, true);
+        ASSERT_NOT_NULL(heap && max_heap);
+
+        int values[1000];
+        srand(arity);
+        for (int i = 0; i < 1000; i++) {
+            values[i] = rand() % 200 - 100;
+            ASSERT_TRUE(intheap_push(heap, values[i]));
+            ASSERT_TRUE(intheap_push(max_heap, values[i]));
+        }
+        ASSERT_EQUAL(intheap_size(heap), 1000);
+        qsort(values, 1000, sizeof (int), ascending);
+
+        int value;
+        ASSERT_TRUE(intheap_peek(max_heap, &value));
+        ASSERT_EQUAL(value, values[999]);
+        for (int i = 0; i < 1000; i++) {
+            ASSERT_TRUE(intheap_pop(heap, &value));
+            ASSERT_EQUAL(value, values[i]);
+            ASSERT_TRUE(intheap_pop(max_heap, &value));
+            ASSERT_EQUAL(value, values[999 - i]);
+        }
+        ASSERT_TRUE(intheap_is_empty(heap));
+    }
+    ASSERT_FALSE(intheap_push(NULL, 1));
+}
+
+TEST(heapify_and_push_n) {
+    int arr[500];
+    srand(7);
+    for (int i = 0; i < 500; i++) arr[i] = rand();
+
+    IntHeap heap = intheap_from_array(arr, 500);
+    ASSERT_NOT_NULL(heap);
+
+    // A small batch is sifted in, a large one rebuilds the heap; both must leave it ordered
+    ASSERT_TRUE(intheap_push_n(heap, arr, 10));
+    ASSERT_TRUE(intheap_push_n(heap, arr, 500));
+    ASSERT_TRUE(intheap_push_n(heap, NULL, 0));
+    ASSERT_FALSE(intheap_push_n(heap, NULL, 3));
+    ASSERT_EQUAL(intheap_size(heap), 1010);
+
+    int last, value;
+    ASSERT_TRUE(intheap_pop(heap, &last));
+    while (intheap_pop(heap, &value)) {
+        ASSERT_TRUE(last <= value);
+        last = value;
+    }
+    ASSERT_NULL(intheap_from_array(NULL, 5));
+
+    // Any arity and either order can be heapified straight from an array
+    IntHeap binary_max = intheap_from_array_with(arr, 500, 2, true);
+    ASSERT_NOT_NULL(binary_max);
+    ASSERT_EQUAL(intheap_arity(binary_max), 2);
+    ASSERT_EQUAL(intheap_size(binary_max), 500);
+
+    bool ordered = intheap_pop(binary_max, &last);
+    while (intheap_pop(binary_max, &value)) {
+        ordered = ordered && last >= value;
+        last = value;
+    }
+    ASSERT_TRUE(ordered);
+    ASSERT_NULL(intheap_from_array_with(arr, 500, 3, false));
+
+    // Empty input gives an empty heap, like the other constructors
+    IntHeap empty = intheap_from_array(NULL, 0);
+    ASSERT_NOT_NULL(empty);
+    ASSERT_TRUE(intheap_is_empty(empty));
+    ASSERT_TRUE(intheap_is_empty(intheap_from_array_with(arr, 0, 8, true)));
+}
+
+TEST(reserve_and_clear) {
+    IntHeap heap = intheap_new_max();
+    ASSERT_NOT_NULL(heap);
+
+    ASSERT_TRUE(intheap_reserve(heap, 100));
+    ASSERT_EQUAL(intheap_capacity(heap), 100);
+    for (int i = 0; i < 50; i++) ASSERT_TRUE(intheap_push(heap, i));
+
+    intheap_clear(heap);
+    ASSERT_TRUE(intheap_is_empty(heap));
+    ASSERT_EQUAL(intheap_capacity(heap), 100);
+
+    int value;
+    ASSERT_TRUE(intheap_push(heap, 3));
+    ASSERT_TRUE(intheap_peek(heap, &value));
+    ASSERT_EQUAL(value, 3);
+    ASSERT_FALSE(intheap_reserve(NULL, 1));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"push and pop", test_push_and_pop},
+        {"heapify and push_n", test_heapify_and_push_n},
+        {"reserve and clear", test_reserve_and_clear},
+    };
+
+    TestSuite suite = {.name = "IntHeap", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
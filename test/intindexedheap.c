@@ -0,0 +1,135 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "heap/intindexedheap.h"
+
+TEST(new) {
+    IntIndexedHeap heap = intindexedheap_new();
+    ASSERT_NOT_NULL(heap);
+    ASSERT_TRUE(intindexedheap_is_empty(heap));
+
+    size_t id;
+    int priority;
+    ASSERT_FALSE(intindexedheap_peek(heap, &id, &priority));
+    ASSERT_FALSE(intindexedheap_contains(heap, 0));
+    ASSERT_FALSE(intindexedheap_remove(heap, 1000));
+}
+
+TEST(push_and_pop) {
+    IntIndexedHeap heap = intindexedheap_new();
+    ASSERT_NOT_NULL(heap);
+
+    // Ids may leave gaps, the id table grows to fit, but ids past the limit are rejected without touching it
+    ASSERT_FALSE(intindexedheap_push(heap, INTINDEXEDHEAP_ID_LIMIT, 0));
+    ASSERT_FALSE(intindexedheap_push(heap, (size_t) -1, 0));
+    ASSERT_TRUE(intindexedheap_is_empty(heap));
+    ASSERT_TRUE(intindexedheap_push(heap, 500, 3));
+    ASSERT_TRUE(intindexedheap_push(heap, 2, 1));
+    ASSERT_TRUE(intindexedheap_push(heap, 40, 2));
+    ASSERT_FALSE(intindexedheap_push(heap, 2, 0));
+    ASSERT_EQUAL(intindexedheap_size(heap), 3);
+
+    size_t id;
+    int priority;
+    size_t expected[] = {2, 40, 500};
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(intindexedheap_pop(heap, &id, &priority));
+        ASSERT_EQUAL(id, expected[i]);
+        ASSERT_EQUAL(priority, i + 1);
+    }
+    ASSERT_FALSE(intindexedheap_contains(heap, 2));
+
+    IntIndexedHeap max_heap = intindexedheap_new_max();
+    ASSERT_TRUE(intindexedheap_push(max_heap, 0, 1) && intindexedheap_push(max_heap, 1, 9));
+    ASSERT_TRUE(intindexedheap_peek(max_heap, &id, NULL));
+    ASSERT_EQUAL(id, 1);
+}
+
+TEST(decrease_key) {
+    IntIndexedHeap heap = intindexedheap_new();
+    ASSERT_NOT_NULL(heap);
+
+    for (size_t i = 0; i < 100; i++) ASSERT_TRUE(intindexedheap_push(heap, i, 1000 + (int) i));
+
+    // A scheduler bumping a task ahead: it becomes the next one out
+    ASSERT_TRUE(intindexedheap_decrease_key(heap, 73, 5));
+    ASSERT_FALSE(intindexedheap_decrease_key(heap, 10, 2000));
+    ASSERT_FALSE(intindexedheap_decrease_key(heap, 100, 0));
+
+    int priority;
+    ASSERT_TRUE(intindexedheap_priority(heap, 73, &priority));
+    ASSERT_EQUAL(priority, 5);
+
+    size_t id;
+    ASSERT_TRUE(intindexedheap_peek(heap, &id, NULL));
+    ASSERT_EQUAL(id, 73);
+
+    // update moves either way
+    ASSERT_TRUE(intindexedheap_update(heap, 73, 5000));
+    ASSERT_TRUE(intindexedheap_peek(heap, &id, NULL));
+    ASSERT_EQUAL(id, 0);
+}
+
+TEST(random_operations) {
+    enum { IDS = 300 };
+    IntIndexedHeap heap = intindexedheap_new();
+    ASSERT_NOT_NULL(heap);
+
+    // A plain array of priorities mirrors the heap; INT_MAX marks ids that are not queued
+    int mirror[IDS];
+    for (int i = 0; i < IDS; i++) mirror[i] = INT_MAX;
+
+    srand(11);
+    for (int step = 0; step < 20000; step++) {
+        size_t id = rand() % IDS;
+        int priority = rand() % 10000;
+        bool queued = mirror[id] != INT_MAX;
+
+        switch (rand() % 4) {
+            case 0:
+                ASSERT_EQUAL(intindexedheap_push(heap, id, priority), !queued);
+                if (!queued) mirror[id] = priority;
+                break;
+            case 1:
+                ASSERT_EQUAL(intindexedheap_update(heap, id, priority), queued);
+                if (queued) mirror[id] = priority;
+                break;
+            case 2:
+                ASSERT_EQUAL(intindexedheap_remove(heap, id), queued);
+                mirror[id] = INT_MAX;
+                break;
+            default: {
+                size_t top;
+                int top_priority;
+                if (!intindexedheap_pop(heap, &top, &top_priority)) break;
+
+                ASSERT_EQUAL(mirror[top], top_priority);
+                for (int i = 0; i < IDS; i++) ASSERT_TRUE(mirror[i] >= top_priority);
+                mirror[top] = INT_MAX;
+            }
+        }
+    }
+
+    size_t remaining = 0;
+    for (int i = 0; i < IDS; i++) remaining += mirror[i] != INT_MAX;
+    ASSERT_EQUAL(intindexedheap_size(heap), remaining);
+
+    intindexedheap_clear(heap);
+    ASSERT_TRUE(intindexedheap_is_empty(heap));
+    ASSERT_TRUE(intindexedheap_push(heap, 0, 1));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"push and pop", test_push_and_pop},
+        {"decrease key", test_decrease_key},
+        {"random operations", test_random_operations},
+    };
+
+    TestSuite suite = {.name = "IntIndexedHeap", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include "test.h"
 #include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
 #include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
 
 TEST(new) {
     IntList list = intlist_new();
@@ -717,6 +722,476 @@ TEST(sum) {
     ASSERT_EQUAL(intlist_sum(NULL), 0);
 }
 
+TEST(push_n_and_extend) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+
+    int arr[] = {1, 2, 3, 4, 5};
+    ASSERT_TRUE(intlist_push_n(list, arr, 5));
+    ASSERT_TRUE(intlist_push_n(list, NULL, 0));
+    ASSERT_FALSE(intlist_push_n(list, NULL, 5));
+    ASSERT_EQUAL(intlist_size(list), 5);
+
+    // Extending a list with itself doubles it
+    ASSERT_TRUE(intlist_extend(list, list));
+    ASSERT_EQUAL(intlist_size(list), 10);
+
+    int value;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(intlist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, arr[i % 5]);
+    }
+    ASSERT_TRUE(intlist_back(list, &value));
+    ASSERT_EQUAL(value, 5);
+
+    // Nodes released by pops are handed out again by the next bulk append
+    for (int i = 0; i < 8; i++) intlist_pop(list);
+    ASSERT_TRUE(intlist_push_n(list, arr, 5));
+    ASSERT_EQUAL(intlist_size(list), 7);
+    ASSERT_TRUE(intlist_get_at(list, 2, &value));
+    ASSERT_EQUAL(value, 1);
+
+    IntStack stack = intlist_to_stack(list);
+    ASSERT_EQUAL(intstack_size(stack), 7);
+    ASSERT_TRUE(intstack_peek(stack, &value));
+    ASSERT_EQUAL(value, 5);
+
+    IntQueue queue = intlist_to_queue(list);
+    ASSERT_EQUAL(intqueue_size(queue), 7);
+    ASSERT_TRUE(intqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 1);
+
+    ASSERT_FALSE(intlist_extend(list, NULL));
+    ASSERT_FALSE(intlist_push_n(NULL, arr, 5));
+}
+
+TEST(text_io) {
+    int arr[] = {0, -7, 42, INT_MAX, INT_MIN, 1000000};
+    IntList list = intlist_from_array(arr, 6);
+    ASSERT_NOT_NULL(list);
+
+    char buf[64];
+    const char* text = "0, -7, 42, 2147483647, -2147483648, 1000000";
+    ASSERT_EQUAL(intlist_format_into(list, buf, sizeof (buf), ", "), strlen(text));
+    ASSERT_TRUE(strcmp(buf, text) == 0);
+
+    // Like snprintf, a short buffer gets a terminated prefix and the full length is still reported
+    ASSERT_EQUAL(intlist_format_into(list, buf, 9, ", "), strlen(text));
+    ASSERT_TRUE(strcmp(buf, "0, -7, 4") == 0);
+    ASSERT_EQUAL(intlist_format_into(list, NULL, 0, NULL), strlen(text) - 5);
+    ASSERT_EQUAL(intlist_format_into(intlist_new(), buf, sizeof (buf), ", "), 0);
+    ASSERT_TRUE(strcmp(buf, "") == 0);
+
+    // Enough values to cross several write buffers and read chunks
+    IntList big = intlist_new();
+    for (int i = 0; i < 100000; i++) ASSERT_TRUE(intlist_push(big, i * 7919 - 300000000));
+
+    FILE* file = tmpfile();
+    ASSERT_NOT_NULL(file);
+    ASSERT_TRUE(intlist_write(big, file, " -> "));
+    rewind(file);
+    ASSERT_TRUE(intlist_equals(intlist_read(file), big));
+
+    // Out of range values make the whole read fail
+    rewind(file);
+    ASSERT_TRUE(ftruncate(fileno(file), 0) == 0);
+    ASSERT_TRUE(fputs("12\n-3,4  -x5\n2147483648", file) >= 0);
+    rewind(file);
+    ASSERT_NULL(intlist_read(file));
+
+    rewind(file);
+    ASSERT_TRUE(ftruncate(fileno(file), 0) == 0);
+    ASSERT_TRUE(fputs("12\n-3,4  -x5\n-2147483648", file) >= 0);
+    rewind(file);
+    IntList parsed = intlist_read(file);
+    int expected[] = {12, -3, 4, 5, INT_MIN};
+    ASSERT_TRUE(intlist_equals(parsed, intlist_from_array(expected, 5)));
+    fclose(file);
+
+    ASSERT_FALSE(intlist_write(NULL, stdout, NULL));
+    ASSERT_NULL(intlist_read(NULL));
+}
+
+TEST(into_conversions) {
+    int arr[] = {1, 2, 3, 4, 5};
+    IntList list = intlist_from_array(arr, 5);
+    ASSERT_NOT_NULL(list);
+
+    // Each move must match the copying conversion and leave the source empty but usable
+    IntStack expected_stack = intlist_to_stack(list);
+    IntStack stack = intlist_into_stack(list);
+    ASSERT_TRUE(intlist_is_empty(list));
+    ASSERT_EQUAL(intstack_size(stack), 5);
+    ASSERT_TRUE(intlist_equals(intstack_to_list(stack), intstack_to_list(expected_stack)));
+
+    IntQueue queue = intstack_into_queue(stack);
+    ASSERT_TRUE(intstack_is_empty(stack));
+    ASSERT_TRUE(intlist_equals(intqueue_to_list(queue), intstack_to_list(expected_stack)));
+    ASSERT_TRUE(intqueue_enqueue(queue, 0));
+
+    stack = intqueue_into_stack(queue);
+    ASSERT_TRUE(intqueue_is_empty(queue));
+    int value;
+    ASSERT_TRUE(intstack_pop(stack, &value));
+    ASSERT_EQUAL(value, 0);
+
+    list = intstack_into_list(stack);
+    ASSERT_TRUE(intlist_equals(list, intlist_from_array(arr, 5)));
+    ASSERT_TRUE(intlist_push(list, 6));
+    ASSERT_TRUE(intlist_get_at(list, 4, &value));
+    ASSERT_EQUAL(value, 5);
+
+    queue = intlist_into_queue(list);
+    ASSERT_TRUE(intlist_is_empty(list));
+    ASSERT_TRUE(intqueue_enqueue(queue, 7));
+    list = intqueue_into_list(queue);
+    ASSERT_EQUAL(intlist_size(list), 7);
+    ASSERT_TRUE(intlist_back(list, &value));
+    ASSERT_EQUAL(value, 7);
+    intlist_reverse(list);
+    ASSERT_TRUE(intlist_back(list, &value));
+    ASSERT_EQUAL(value, 1);
+
+    // Sources stay usable after being drained
+    ASSERT_TRUE(intqueue_enqueue(queue, 8));
+    ASSERT_TRUE(intqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 8);
+
+    ASSERT_TRUE(intstack_is_empty(intlist_into_stack(intlist_new())));
+    ASSERT_NULL(intqueue_into_list(NULL));
+
+    // The stack's array becomes the ring, which is widened when its capacity is not a power of two large enough
+    stack = intstack_new();
+    ASSERT_TRUE(intstack_reserve(stack, 100));
+    for (int i = 0; i < 70; i++) ASSERT_TRUE(intstack_push(stack, i));
+
+    queue = intstack_into_queue(stack);
+    ASSERT_EQUAL(intstack_capacity(stack), 0);
+    ASSERT_EQUAL(intqueue_size(queue), 70);
+    for (int i = 0; i < 40; i++) ASSERT_TRUE(intqueue_enqueue(queue, -i));
+
+    bool in_order = true;
+    for (int i = 69; i >= 0; i--) in_order = in_order && intqueue_dequeue(queue, &value) && value == i;
+    for (int i = 0; i < 40; i++) in_order = in_order && intqueue_dequeue(queue, &value) && value == -i;
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(intstack_push(stack, 1));
+}
+
+TEST(concat_splice_split) {
+    int arr1[] = {1, 2, 3}, arr2[] = {4, 5}, arr3[] = {10, 20};
+    IntList list = intlist_from_array(arr1, 3);
+    IntList other = intlist_from_array(arr2, 2);
+    ASSERT_NOT_NULL(list);
+    ASSERT_NOT_NULL(other);
+
+    // Concatenation steals the nodes of the source, leaving it empty but usable
+    ASSERT_TRUE(intlist_concat(list, other));
+    ASSERT_TRUE(intlist_is_empty(other));
+    ASSERT_EQUAL(intlist_size(list), 5);
+    ASSERT_TRUE(intlist_push(other, 6));
+    ASSERT_TRUE(intlist_concat(list, other));
+    ASSERT_TRUE(intlist_concat(list, other));
+
+    int value;
+    for (int i = 0; i < 6; i++) {
+        ASSERT_TRUE(intlist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, i + 1);
+    }
+
+    // The finger is left at index 4 by the loop above and must follow its node across the splice
+    ASSERT_TRUE(intlist_splice(list, 2, intlist_from_array(arr3, 2)));
+    ASSERT_EQUAL(intlist_size(list), 8);
+    int expected[] = {1, 2, 10, 20, 3, 4, 5, 6};
+    for (int i = 7; i >= 0; i--) {
+        ASSERT_TRUE(intlist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, expected[i]);
+    }
+    ASSERT_TRUE(intlist_splice(list, 0, intlist_from_array(arr3, 1)));
+    ASSERT_TRUE(intlist_front(list, &value));
+    ASSERT_EQUAL(value, 10);
+
+    IntList rest = intlist_split_at(list, 3);
+    ASSERT_EQUAL(intlist_size(list), 3);
+    ASSERT_EQUAL(intlist_size(rest), 6);
+    ASSERT_TRUE(intlist_back(list, &value));
+    ASSERT_EQUAL(value, 2);
+    ASSERT_TRUE(intlist_get_at(rest, 0, &value));
+    ASSERT_EQUAL(value, 10);
+    ASSERT_TRUE(intlist_push_front(rest, 0));
+    ASSERT_TRUE(intlist_push(list, 0));
+    ASSERT_EQUAL(intlist_sum(list) + intlist_sum(rest), 61);
+
+    // Splitting at either end moves everything or nothing
+    ASSERT_TRUE(intlist_is_empty(intlist_split_at(list, 4)));
+    IntList all = intlist_split_at(list, 0);
+    ASSERT_TRUE(intlist_is_empty(list));
+    ASSERT_EQUAL(intlist_size(all), 4);
+
+    ASSERT_FALSE(intlist_concat(all, all));
+    ASSERT_FALSE(intlist_splice(all, 5, rest));
+    ASSERT_FALSE(intlist_concat(NULL, rest));
+    ASSERT_NULL(intlist_split_at(all, 5));
+}
+
+TEST(split_relinks) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+    for (int i = 0; i < 3000; i++) ASSERT_TRUE(intlist_push(list, i));
+
+    // A cursor on either side keeps its node, since split moves nodes instead of copying them
+    IntListCursor cursor = intlist_cursor_new(list);
+    ASSERT_TRUE(intlist_cursor_seek(cursor, 1));
+    IntList rest = intlist_split_at(list, 3);
+    ASSERT_EQUAL(intlist_size(list), 3);
+    ASSERT_EQUAL(intlist_size(rest), 2997);
+
+    int value;
+    ASSERT_TRUE(intlist_cursor_get(cursor, &value));
+    ASSERT_EQUAL(value, 1);
+    ASSERT_TRUE(intlist_cursor_remove(cursor));
+    ASSERT_EQUAL(intlist_size(list), 2);
+
+    // Nodes from one list's slabs can be freed and replaced from the other list across several slabs
+    IntList back = intlist_split_at(rest, 1000);
+    ASSERT_TRUE(intlist_splice(list, 1, back));
+    for (int i = 0; i < 1500; i++) intlist_pop(list);
+    intlist_clear(rest);
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(intlist_push(rest, i));
+    ASSERT_EQUAL(intlist_size(rest), 1000);
+    ASSERT_EQUAL(intlist_size(list), 499);
+}
+
+TEST(sort) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+
+    intlist_sort(list);
+    ASSERT_TRUE(intlist_is_empty(list));
+
+    // Small lists take the merge sort path, large ones the radix path
+    int sizes[] = {7, 1000};
+    for (int s = 0; s < 2; s++) {
+        intlist_clear(list);
+        for (int i = 0; i < sizes[s]; i++) ASSERT_TRUE(intlist_push(list, (i * 7919) % 1009 - 500));
+
+        long long sum = intlist_sum(list);
+        intlist_sort(list);
+        ASSERT_EQUAL(intlist_size(list), sizes[s]);
+        ASSERT_EQUAL(intlist_sum(list), sum);
+
+        int prev, value;
+        ASSERT_TRUE(intlist_front(list, &prev));
+        for (int i = 1; i < sizes[s]; i++) {
+            ASSERT_TRUE(intlist_get_at(list, i, &value));
+            ASSERT_TRUE(prev <= value);
+            prev = value;
+        }
+    }
+
+    int arr[] = {2, 1, -3};
+    IntList small = intlist_from_array(arr, 3);
+    intlist_sort(small);
+    int sorted[] = {-3, 1, 2};
+    ASSERT_TRUE(intlist_equals(small, intlist_from_array(sorted, 3)));
+
+    intlist_sort(NULL);
+}
+
+TEST(sort_by) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 0; i < 100; i++) ASSERT_TRUE(intlist_push(list, i));
+
+    int by_last_digit(int a, int b, void* ctx) { return a % 10 - b % 10; }
+    int descending(int a, int b, void* ctx) { return *(int*) ctx * (a - b); }
+
+    // Elements with the same last digit must keep their ascending order
+    intlist_sort_by(list, by_last_digit, NULL);
+    int value;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(intlist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, i % 10 * 10 + i / 10);
+    }
+
+    int sign = -1;
+    intlist_sort_by(list, descending, &sign);
+    ASSERT_TRUE(intlist_front(list, &value));
+    ASSERT_EQUAL(value, 99);
+    ASSERT_TRUE(intlist_back(list, &value));
+    ASSERT_EQUAL(value, 0);
+
+    intlist_pop(list);
+    ASSERT_TRUE(intlist_back(list, &value));
+    ASSERT_EQUAL(value, 1);
+
+    intlist_sort_by(list, NULL, NULL);
+    ASSERT_TRUE(intlist_front(list, &value));
+    ASSERT_EQUAL(value, 1);
+}
+
+TEST(parallel) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+
+    // Large enough to be split into chunks instead of taking the sequential path
+    for (int i = 0; i < 100000; i++) ASSERT_TRUE(intlist_push(list, i));
+
+    int triple(int num) { return 3 * num; }
+    bool is_even(int num) { return num % 2 == 0; }
+    long long add(long long acc, int value) { return acc + value; }
+    long long combine(long long acc1, long long acc2) { return acc1 + acc2; }
+
+    IntList tripled = intlist_par_map(list, triple);
+    ASSERT_TRUE(intlist_equals(tripled, intlist_map(list, triple)));
+
+    IntList evens = intlist_par_filter(list, is_even);
+    ASSERT_EQUAL(intlist_size(evens), 50000);
+    ASSERT_TRUE(intlist_equals(evens, intlist_filter(list, is_even)));
+
+    ASSERT_EQUAL(intlist_par_reduce(list, add, combine, 0), intlist_sum(list));
+    ASSERT_EQUAL(intlist_par_reduce(list, add, NULL, 0), intlist_sum(list));
+
+    // Small inputs fall back to the sequential implementations
+    int arr[] = {1, 2, 3};
+    IntList small = intlist_from_array(arr, 3);
+    ASSERT_EQUAL(intlist_par_reduce(small, add, combine, 10), 16);
+    ASSERT_EQUAL(intlist_size(intlist_par_filter(small, is_even)), 1);
+
+    ASSERT_NULL(intlist_par_map(NULL, triple));
+    ASSERT_EQUAL(intlist_par_reduce(NULL, add, combine, 7), 7);
+}
+
+TEST(batch) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+
+    // Not a multiple of the batch size, so the last callback gets a partial block
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(intlist_push(list, i));
+
+    int triple(int num) { return 3 * num; }
+    bool is_even(int num) { return num % 2 == 0; }
+    void triple_batch(int* values, size_t size, void* ctx) {
+        (*(int*) ctx)++;
+        for (size_t i = 0; i < size; i++) values[i] *= 3;
+    }
+    void even_batch(const int* values, bool* keep, size_t size, void* ctx) {
+        (void) ctx;
+        for (size_t i = 0; i < size; i++) keep[i] = values[i] % 2 == 0;
+    }
+    long long add_batch(long long acc, const int* values, size_t size, void* ctx) {
+        (void) ctx;
+        for (size_t i = 0; i < size; i++) acc += values[i];
+        return acc;
+    }
+
+    int calls = 0;
+    IntList tripled = intlist_map_batch(list, triple_batch, &calls);
+    ASSERT_TRUE(intlist_equals(tripled, intlist_map(list, triple)));
+    ASSERT_EQUAL(calls, 4);
+
+    IntList evens = intlist_filter_batch(list, even_batch, NULL);
+    ASSERT_EQUAL(intlist_size(evens), 500);
+    ASSERT_TRUE(intlist_equals(evens, intlist_filter(list, is_even)));
+
+    ASSERT_EQUAL(intlist_reduce_batch(list, add_batch, 10, NULL), intlist_sum(list) + 10);
+
+    intlist_foreach_batch(list, triple_batch, &calls);
+    ASSERT_TRUE(intlist_equals(list, tripled));
+    ASSERT_EQUAL(calls, 8);
+
+    ASSERT_TRUE(intlist_equals(intlist_map_batch(list, NULL, NULL), list));
+    ASSERT_TRUE(intlist_is_empty(intlist_map_batch(intlist_new(), triple_batch, &calls)));
+    ASSERT_EQUAL(calls, 8);
+    ASSERT_NULL(intlist_filter_batch(NULL, even_batch, NULL));
+    ASSERT_EQUAL(intlist_reduce_batch(NULL, add_batch, 7, NULL), 7);
+}
+
+TEST(sequential_get_at) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 0; i < 100; i++) ASSERT_TRUE(intlist_push(list, i));
+
+    // Positional accesses interleaved with edits at both ends and in the middle must stay consistent
+    int value;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(intlist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, i);
+    }
+
+    ASSERT_TRUE(intlist_get_at(list, 50, &value));
+    ASSERT_TRUE(intlist_push_front(list, -1));
+    ASSERT_TRUE(intlist_get_at(list, 51, &value));
+    ASSERT_EQUAL(value, 50);
+
+    intlist_pop_front(list);
+    ASSERT_TRUE(intlist_get_at(list, 49, &value));
+    ASSERT_EQUAL(value, 49);
+
+    ASSERT_TRUE(intlist_push_at(list, 1000, 49));
+    ASSERT_TRUE(intlist_get_at(list, 50, &value));
+    ASSERT_EQUAL(value, 49);
+
+    intlist_pop_at(list, 49);
+    ASSERT_TRUE(intlist_get_at(list, 49, &value));
+    ASSERT_EQUAL(value, 49);
+
+    intlist_reverse(list);
+    ASSERT_TRUE(intlist_get_at(list, 48, &value));
+    ASSERT_EQUAL(value, 51);
+    ASSERT_TRUE(intlist_get_at(list, 0, &value));
+    ASSERT_EQUAL(value, 99);
+}
+
+TEST(cursor) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+
+    IntListCursor cursor = intlist_cursor_new(list);
+    ASSERT_NOT_NULL(cursor);
+    ASSERT_FALSE(intlist_cursor_is_valid(cursor));
+
+    // Inserting at the end position appends
+    for (int i = 0; i < 5; i++) ASSERT_TRUE(intlist_cursor_insert(cursor, i * 10));
+    ASSERT_EQUAL(intlist_size(list), 5);
+    ASSERT_EQUAL(intlist_cursor_index(cursor), 5);
+
+    int value;
+    ASSERT_TRUE(intlist_cursor_prev(cursor));
+    ASSERT_TRUE(intlist_cursor_get(cursor, &value));
+    ASSERT_EQUAL(value, 40);
+
+    // Walk back to the front, doubling every element
+    do {
+        ASSERT_TRUE(intlist_cursor_get(cursor, &value));
+        ASSERT_TRUE(intlist_cursor_set(cursor, value * 2));
+    } while (intlist_cursor_prev(cursor));
+    ASSERT_EQUAL(intlist_cursor_index(cursor), 0);
+
+    // Insert before every element and remove the originals: [0, 20, 40, 60, 80] -> [1, 21, 41, 61, 81]
+    while (intlist_cursor_is_valid(cursor)) {
+        ASSERT_TRUE(intlist_cursor_get(cursor, &value));
+        ASSERT_TRUE(intlist_cursor_insert(cursor, value + 1));
+        ASSERT_TRUE(intlist_cursor_remove(cursor));
+    }
+    ASSERT_FALSE(intlist_cursor_next(cursor));
+    ASSERT_FALSE(intlist_cursor_remove(cursor));
+
+    int expected[] = {1, 21, 41, 61, 81};
+    ASSERT_TRUE(intlist_equals(list, intlist_from_array(expected, 5)));
+
+    ASSERT_TRUE(intlist_cursor_seek(cursor, 2));
+    ASSERT_TRUE(intlist_cursor_get(cursor, &value));
+    ASSERT_EQUAL(value, 41);
+    ASSERT_TRUE(intlist_cursor_seek(cursor, 5));
+    ASSERT_FALSE(intlist_cursor_is_valid(cursor));
+    ASSERT_FALSE(intlist_cursor_seek(cursor, 6));
+
+    ASSERT_NULL(intlist_cursor_new(NULL));
+    ASSERT_FALSE(intlist_cursor_next(NULL));
+}
+
 int main() {
     TestCase tests[] = {
         {"new", test_new},
@@ -742,6 +1217,17 @@ int main() {
         {"all", test_all},
         {"any", test_any},
         {"sum", test_sum},
+        {"push_n and extend", test_push_n_and_extend},
+        {"concat, splice and split", test_concat_splice_split},
+        {"split relinks", test_split_relinks},
+        {"into conversions", test_into_conversions},
+        {"text io", test_text_io},
+        {"sort", test_sort},
+        {"sort_by", test_sort_by},
+        {"parallel", test_parallel},
+        {"batch", test_batch},
+        {"sequential get_at", test_sequential_get_at},
+        {"cursor", test_cursor},
     };
 
     TestSuite suite = {.name = "IntList", .tests = tests, .tests_num = sizeof (tests) / sizeof(tests[0])};
@@ -182,6 +182,75 @@ TEST(resize) {
     ASSERT_EQUAL(intmap_size(map), 1000);
 }
 
+TEST(stats) {
+    IntMap map = intmap_new();
+    ASSERT_NOT_NULL(map);
+
+    IntMapStats stats;
+    ASSERT_TRUE(intmap_stats(map, &stats));
+    ASSERT_EQUAL(stats.capacity, 16);
+    ASSERT_EQUAL(stats.size, 0);
+    ASSERT_EQUAL(stats.chain_histogram[0], 16);
+    ASSERT_EQUAL(stats.max_chain, 0);
+    ASSERT_TRUE(stats.empty_bucket_ratio == 1.0);
+    ASSERT_EQUAL(stats.resize_count, 0);
+
+    for (int i = 0; i < 100; i++) {
+        char key[16];
+        sprintf(key, "key%d", i);
+        ASSERT_TRUE(intmap_insert(map, key, i));
+    }
+
+    ASSERT_TRUE(intmap_stats(map, &stats));
+    ASSERT_EQUAL(stats.size, 100);
+    ASSERT_EQUAL(stats.capacity, 256);
+    ASSERT_EQUAL(stats.resize_count, 4);
+    ASSERT_TRUE(stats.load_factor > 0.39 && stats.load_factor < 0.4);
+    ASSERT_TRUE(stats.max_chain >= 1);
+
+    // Every bucket is counted exactly once in the histogram
+    uint32_t buckets = 0;
+    for (int i = 0; i < INTMAP_STATS_HISTOGRAM_SIZE; i++) buckets += stats.chain_histogram[i];
+    ASSERT_EQUAL(buckets, stats.capacity);
+    ASSERT_TRUE(stats.bytes_used > stats.capacity * sizeof (void*));
+
+    ASSERT_FALSE(intmap_stats(map, NULL));
+    ASSERT_FALSE(intmap_stats(NULL, &stats));
+}
+
+TEST(hashed) {
+    IntMap overrides = intmap_new();
+    IntMap defaults = intmap_new();
+    ASSERT_NOT_NULL(overrides && defaults);
+
+    uint32_t hash = intmap_hash_key("timeout");
+    ASSERT_EQUAL(hash, intmap_hash_key("timeout"));
+    ASSERT_NOT_EQUAL(hash, intmap_hash_key("retries"));
+
+    // The same hash token is reused across maps
+    int value;
+    ASSERT_TRUE(intmap_insert_hashed(defaults, "timeout", hash, 30));
+    ASSERT_FALSE(intmap_get_hashed(overrides, "timeout", hash, &value));
+    ASSERT_TRUE(intmap_get_hashed(defaults, "timeout", hash, &value));
+    ASSERT_EQUAL(value, 30);
+    ASSERT_FALSE(intmap_insert_hashed(defaults, "timeout", hash, 60));
+
+    // Entries inserted through the prehashed API are visible to the plain one, and vice versa
+    ASSERT_TRUE(intmap_get(defaults, "timeout", &value));
+    ASSERT_EQUAL(value, 30);
+    ASSERT_TRUE(intmap_insert(overrides, "timeout", 5));
+    ASSERT_TRUE(intmap_get_hashed(overrides, "timeout", hash, &value));
+    ASSERT_EQUAL(value, 5);
+
+    intmap_remove_hashed(overrides, "timeout", hash);
+    ASSERT_FALSE(intmap_has_key(overrides, "timeout"));
+    ASSERT_EQUAL(intmap_size(overrides), 0);
+
+    ASSERT_FALSE(intmap_get_hashed(defaults, NULL, hash, &value));
+    ASSERT_FALSE(intmap_get_hashed(defaults, "timeout", hash, NULL));
+    ASSERT_FALSE(intmap_insert_hashed(NULL, "timeout", hash, 1));
+}
+
 TEST(iter_new) {
     IntMap map = intmap_new();
     ASSERT_NOT_NULL(map);
@@ -273,6 +342,8 @@ int main() {
         {"equals", test_equals},
         {"keys and values", test_keys_and_values},
         {"resize", test_resize},
+        {"stats", test_stats},
+        {"hashed", test_hashed},
         {"iter new", test_iter_new},
         {"iter next", test_iter_next},
         {"iter reset", test_iter_reset},
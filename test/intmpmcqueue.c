@@ -0,0 +1,189 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "queue/intmpmcqueue.h"
+
+TEST(new) {
+    IntMpmcQueue queue = intmpmcqueue_new(10);
+    ASSERT_NOT_NULL(queue);
+
+    // The ring is rounded up to a power of two, and that is the capacity reported
+    ASSERT_EQUAL(intmpmcqueue_capacity(queue), 16);
+    ASSERT_TRUE(intmpmcqueue_is_empty(queue));
+    ASSERT_FALSE(intmpmcqueue_is_full(queue));
+
+    int value;
+    ASSERT_FALSE(intmpmcqueue_dequeue(queue, &value));
+    ASSERT_NULL(intmpmcqueue_new(0));
+    ASSERT_FALSE(intmpmcqueue_enqueue(NULL, 1));
+}
+
+TEST(bounded_fifo) {
+    IntMpmcQueue queue = intmpmcqueue_new(8);
+    ASSERT_NOT_NULL(queue);
+
+    int next_in = 0, next_out = 0, value;
+    for (int round = 0; round < 50; round++) {
+        while (intmpmcqueue_enqueue(queue, next_in)) next_in++;
+        ASSERT_TRUE(intmpmcqueue_is_full(queue));
+        ASSERT_EQUAL(intmpmcqueue_size(queue), 8);
+
+        for (int i = 0; i < 5; i++) {
+            ASSERT_TRUE(intmpmcqueue_dequeue_wait(queue, &value));
+            ASSERT_EQUAL(value, next_out++);
+        }
+    }
+    while (intmpmcqueue_dequeue(queue, &value)) ASSERT_EQUAL(value, next_out++);
+    ASSERT_EQUAL(next_out, next_in);
+}
+
+TEST(batches) {
+    IntMpmcQueue queue = intmpmcqueue_new(32);
+    ASSERT_NOT_NULL(queue);
+
+    int arr[13], out[11];
+    int next_in = 0, next_out = 0;
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 13; i++) arr[i] = next_in + i;
+        size_t sent = intmpmcqueue_enqueue_n(queue, arr, 13);
+        ASSERT_TRUE(intmpmcqueue_size(queue) <= 32);
+        next_in += sent;
+
+        // Single and batched calls share the same positions, so they can be mixed freely
+        int value;
+        ASSERT_TRUE(intmpmcqueue_dequeue(queue, &value));
+        ASSERT_EQUAL(value, next_out++);
+
+        size_t got = intmpmcqueue_dequeue_n(queue, out, 11);
+        for (size_t i = 0; i < got; i++) ASSERT_EQUAL(out[i], next_out++);
+    }
+    ASSERT_EQUAL(intmpmcqueue_size(queue), next_in - next_out);
+    ASSERT_EQUAL(intmpmcqueue_enqueue_n(queue, NULL, 3), 0);
+}
+
+TEST(many_threads) {
+    enum { THREADS = 4, PER_PRODUCER = 100000 };
+    IntMpmcQueue queue = intmpmcqueue_new(256);
+    ASSERT_NOT_NULL(queue);
+
+    atomic_llong total = 0;
+    atomic_int received = 0;
+    atomic_bool ordered = true;
+
+    // Each producer tags its values, so every consumer must see any one producer's values in increasing order
+    void* produce(void* arg) {
+        int id = (int) (long) arg, batch[16];
+        for (int i = 0; i < PER_PRODUCER; ) {
+            if (id % 2 == 0) {
+                intmpmcqueue_enqueue_wait(queue, i * THREADS + id);
+                i++;
+                continue;
+            }
+
+            int size = PER_PRODUCER - i < 16 ? PER_PRODUCER - i : 16;
+            for (int j = 0; j < size; j++) batch[j] = (i + j) * THREADS + id;
+            size_t sent = intmpmcqueue_enqueue_n(queue, batch, size);
+            if (sent == 0) sched_yield();
+            i += sent;
+        }
+        return NULL;
+    }
+    void* consume(void* arg) {
+        int id = (int) (long) arg, last[THREADS], out[16];
+        for (int i = 0; i < THREADS; i++) last[i] = -1;
+
+        while (atomic_load(&received) < THREADS * PER_PRODUCER) {
+            size_t got = id % 2 == 0 ? intmpmcqueue_dequeue_n(queue, out, 16) : intmpmcqueue_dequeue(queue, out);
+            if (got == 0) sched_yield();
+
+            for (size_t i = 0; i < got; i++) {
+                int producer = out[i] % THREADS;
+                if (out[i] <= last[producer]) atomic_store(&ordered, false);
+                last[producer] = out[i];
+                atomic_fetch_add(&total, out[i]);
+            }
+            atomic_fetch_add(&received, got);
+        }
+        return NULL;
+    }
+
+    pthread_t producers[THREADS], consumers[THREADS];
+    for (long i = 0; i < THREADS; i++) {
+        ASSERT_EQUAL(pthread_create(&producers[i], NULL, produce, (void*) i), 0);
+        ASSERT_EQUAL(pthread_create(&consumers[i], NULL, consume, (void*) i), 0);
+    }
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+
+    long long count = (long long) THREADS * PER_PRODUCER;
+    ASSERT_EQUAL(atomic_load(&received), count);
+    ASSERT_EQUAL(atomic_load(&total), count * (count - 1) / 2);
+    ASSERT_TRUE(atomic_load(&ordered));
+    ASSERT_TRUE(intmpmcqueue_is_empty(queue));
+}
+
+TEST(parked_waits) {
+    IntMpmcQueue queue = intmpmcqueue_new(2);
+    ASSERT_NOT_NULL(queue);
+
+    atomic_int sum = 0;
+    void* consume(void* arg) {
+        int value;
+        for (int i = 0; i < 3; i++) {
+            intmpmcqueue_dequeue_wait(queue, &value);
+            atomic_fetch_add(&sum, value);
+        }
+        return arg;
+    }
+
+    // The sleeps outlast the spinning, so each waiter is parked by the time the other side moves
+    pthread_t consumer;
+    ASSERT_EQUAL(pthread_create(&consumer, NULL, consume, NULL), 0);
+    usleep(50000);
+    ASSERT_TRUE(intmpmcqueue_enqueue(queue, 1));
+    usleep(50000);
+    int arr[] = {2, 3};
+    ASSERT_EQUAL(intmpmcqueue_enqueue_n(queue, arr, 2), 2);
+    pthread_join(consumer, NULL);
+    ASSERT_EQUAL(atomic_load(&sum), 6);
+
+    void* produce(void* arg) {
+        for (int i = 0; i < 4; i++) intmpmcqueue_enqueue_wait(queue, i);
+        return arg;
+    }
+
+    pthread_t producer;
+    ASSERT_EQUAL(pthread_create(&producer, NULL, produce, NULL), 0);
+    usleep(50000);
+    ASSERT_TRUE(intmpmcqueue_is_full(queue));
+
+    int value, out[2];
+    ASSERT_TRUE(intmpmcqueue_dequeue(queue, &value));
+    ASSERT_EQUAL(value, 0);
+    usleep(50000);
+    ASSERT_EQUAL(intmpmcqueue_dequeue_n(queue, out, 2), 2);
+    pthread_join(producer, NULL);
+    ASSERT_EQUAL(out[0], 1);
+    ASSERT_EQUAL(out[1], 2);
+    ASSERT_TRUE(intmpmcqueue_dequeue(queue, &value));
+    ASSERT_EQUAL(value, 3);
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"bounded fifo", test_bounded_fifo},
+        {"batches", test_batches},
+        {"many threads", test_many_threads},
+        {"parked waits", test_parked_waits},
+    };
+
+    TestSuite suite = {.name = "IntMpmcQueue", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
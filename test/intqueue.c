@@ -0,0 +1,144 @@
+#include "test.h"
+#include <stdio.h>
+#include "queue/intqueue.h"
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+
+TEST(new) {
+    IntQueue queue = intqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    ASSERT_TRUE(intqueue_is_empty(queue));
+    ASSERT_EQUAL(intqueue_size(queue), 0);
+    ASSERT_FALSE(intqueue_is_full(queue));
+
+    int value;
+    ASSERT_FALSE(intqueue_peek(queue, &value));
+    ASSERT_FALSE(intqueue_dequeue(queue, &value));
+}
+
+TEST(fifo_order) {
+    IntQueue queue = intqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    // Interleaving keeps the head moving, so the ring wraps around before every growth
+    int next_in = 0, next_out = 0, value;
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 7; i++) ASSERT_TRUE(intqueue_enqueue(queue, next_in++));
+        for (int i = 0; i < 5; i++) {
+            ASSERT_TRUE(intqueue_dequeue(queue, &value));
+            ASSERT_EQUAL(value, next_out++);
+        }
+    }
+    ASSERT_EQUAL(intqueue_size(queue), 400);
+
+    ASSERT_TRUE(intqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, next_out);
+    while (intqueue_dequeue(queue, &value)) ASSERT_EQUAL(value, next_out++);
+    ASSERT_EQUAL(next_out, next_in);
+
+    ASSERT_FALSE(intqueue_enqueue(NULL, 1));
+}
+
+TEST(enqueue_n) {
+    IntQueue queue = intqueue_new();
+    ASSERT_NOT_NULL(queue);
+
+    int arr[100];
+    for (int i = 0; i < 100; i++) arr[i] = i;
+
+    // Leave the head mid-ring so the bulk copy has to split around the end
+    ASSERT_TRUE(intqueue_enqueue_n(queue, arr, 6));
+    for (int i = 0; i < 5; i++) ASSERT_TRUE(intqueue_dequeue(queue, NULL));
+    ASSERT_TRUE(intqueue_enqueue_n(queue, arr, 6));
+    ASSERT_TRUE(intqueue_enqueue_n(queue, arr, 100));
+    ASSERT_TRUE(intqueue_enqueue_n(queue, NULL, 0));
+    ASSERT_FALSE(intqueue_enqueue_n(queue, NULL, 3));
+    ASSERT_EQUAL(intqueue_size(queue), 107);
+
+    IntList list = intqueue_to_list(queue);
+    int value;
+    ASSERT_TRUE(intlist_get_at(list, 0, &value));
+    ASSERT_EQUAL(value, 5);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(intlist_get_at(list, 7 + i, &value));
+        ASSERT_EQUAL(value, i);
+    }
+
+    int out[110];
+    ASSERT_EQUAL(intqueue_dequeue_n(queue, out, 110), 107);
+    ASSERT_EQUAL(out[0], 5);
+    for (int i = 0; i < 100; i++) ASSERT_EQUAL(out[7 + i], i);
+    ASSERT_EQUAL(intqueue_dequeue_n(queue, out, 1), 0);
+
+    // The head now sits near the end of the ring, so both the refill and the drain wrap around
+    ASSERT_TRUE(intqueue_enqueue_n(queue, arr, 30));
+    ASSERT_EQUAL(intqueue_dequeue_n(queue, out, 30), 30);
+    for (int i = 0; i < 30; i++) ASSERT_EQUAL(out[i], i);
+}
+
+TEST(bounded) {
+    IntQueue queue = intqueue_new_bounded(10);
+    ASSERT_NOT_NULL(queue);
+    ASSERT_EQUAL(intqueue_capacity(queue), 10);
+
+    for (int i = 0; i < 10; i++) ASSERT_TRUE(intqueue_enqueue(queue, i));
+    ASSERT_TRUE(intqueue_is_full(queue));
+    ASSERT_FALSE(intqueue_enqueue(queue, 10));
+
+    int arr[] = {1, 2};
+    ASSERT_TRUE(intqueue_dequeue(queue, NULL));
+    ASSERT_FALSE(intqueue_enqueue_n(queue, arr, 2));
+    ASSERT_TRUE(intqueue_enqueue_n(queue, arr, 1));
+    ASSERT_EQUAL(intqueue_size(queue), 10);
+
+    intqueue_clear(queue);
+    ASSERT_TRUE(intqueue_is_empty(queue));
+    ASSERT_FALSE(intqueue_is_full(queue));
+    ASSERT_NULL(intqueue_new_bounded(0));
+}
+
+TEST(into_conversions) {
+    IntQueue queue = intqueue_new();
+    for (int i = 0; i < 6; i++) ASSERT_TRUE(intqueue_enqueue(queue, -1));
+    for (int i = 0; i < 6; i++) ASSERT_TRUE(intqueue_dequeue(queue, NULL));
+
+    // The values wrap around the end of the ring, which is rotated in place before the stack takes it
+    for (int i = 0; i < 7; i++) ASSERT_TRUE(intqueue_enqueue(queue, i));
+    IntStack stack = intqueue_into_stack(queue);
+    ASSERT_TRUE(intqueue_is_empty(queue));
+    ASSERT_EQUAL(intstack_size(stack), 7);
+    ASSERT_EQUAL(intstack_capacity(stack), 8);
+
+    bool in_order = true;
+    int value;
+    for (int i = 6; i >= 0; i--) in_order = in_order && intstack_pop(stack, &value) && value == i;
+    ASSERT_TRUE(in_order);
+
+    for (int i = 0; i < 20; i++) ASSERT_TRUE(intqueue_enqueue(queue, i));
+    for (int i = 0; i < 5; i++) ASSERT_TRUE(intqueue_dequeue(queue, NULL));
+    IntList list = intqueue_into_list(queue);
+    ASSERT_TRUE(intqueue_is_empty(queue));
+    ASSERT_EQUAL(intlist_size(list), 15);
+    ASSERT_TRUE(intlist_front(list, &value));
+    ASSERT_EQUAL(value, 5);
+
+    ASSERT_TRUE(intqueue_enqueue(queue, 1));
+    ASSERT_TRUE(intqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 1);
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"fifo order", test_fifo_order},
+        {"enqueue_n", test_enqueue_n},
+        {"bounded", test_bounded},
+        {"into conversions", test_into_conversions},
+    };
+
+    TestSuite suite = {.name = "IntQueue", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
@@ -0,0 +1,186 @@
+#include "test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist/intskiplist.h"
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+
+TEST(new) {
+    IntSkipList list = intskiplist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(intskiplist_is_empty(list));
+    ASSERT_EQUAL(intskiplist_size(list), 0);
+
+    int value;
+    ASSERT_FALSE(intskiplist_front(list, &value) || intskiplist_back(list, &value));
+    ASSERT_FALSE(intskiplist_get_at(list, 0, &value));
+}
+
+TEST(push_and_pop_ends) {
+    IntSkipList list = intskiplist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 0; i < 500; i++) {
+        ASSERT_TRUE(intskiplist_push(list, i));
+        ASSERT_TRUE(intskiplist_push_front(list, -i - 1));
+    }
+    ASSERT_EQUAL(intskiplist_size(list), 1000);
+
+    int value;
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_TRUE(intskiplist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, i - 500);
+    }
+
+    intskiplist_pop_front(list);
+    intskiplist_pop(list);
+    ASSERT_TRUE(intskiplist_front(list, &value));
+    ASSERT_EQUAL(value, -499);
+    ASSERT_TRUE(intskiplist_back(list, &value));
+    ASSERT_EQUAL(value, 498);
+
+    while (!intskiplist_is_empty(list)) intskiplist_pop_front(list);
+    ASSERT_EQUAL(intskiplist_size(list), 0);
+    ASSERT_TRUE(intskiplist_push(list, 7));
+    ASSERT_TRUE(intskiplist_get_at(list, 0, &value));
+    ASSERT_EQUAL(value, 7);
+
+    ASSERT_FALSE(intskiplist_push(NULL, 1));
+}
+
+TEST(random_positions) {
+    IntSkipList list = intskiplist_new();
+    IntList reference = intlist_new();
+    ASSERT_NOT_NULL(list && reference);
+
+    ASSERT_FALSE(intskiplist_push_at(list, 1, 1));
+
+    srand(1234);
+    for (int i = 0; i < 5000; i++) {
+        size_t size = intskiplist_size(list);
+        int op = rand() % 4;
+        if (size > 0 && op == 0) {
+            size_t index = rand() % size;
+            intskiplist_pop_at(list, index);
+            intlist_pop_at(reference, index);
+        } else if (size > 0 && op == 1) {
+            size_t index = rand() % size;
+            ASSERT_TRUE(intskiplist_set_at(list, index, -i));
+            intlist_pop_at(reference, index);
+            ASSERT_TRUE(intlist_push_at(reference, -i, index));
+        } else {
+            size_t index = rand() % (size + 1);
+            ASSERT_TRUE(intskiplist_push_at(list, i, index));
+            ASSERT_TRUE(intlist_push_at(reference, i, index));
+        }
+    }
+
+    ASSERT_EQUAL(intskiplist_size(list), intlist_size(reference));
+
+    int value, expected;
+    for (size_t i = 0; i < intlist_size(reference); i++) {
+        ASSERT_TRUE(intskiplist_get_at(list, i, &value));
+        ASSERT_TRUE(intlist_get_at(reference, i, &expected));
+        ASSERT_EQUAL(expected, value);
+    }
+    ASSERT_TRUE(intlist_equals(intskiplist_to_list(list), reference));
+}
+
+TEST(reverse) {
+    IntSkipList list = intskiplist_new();
+    ASSERT_NOT_NULL(list);
+
+    for (int i = 0; i < 300; i++) ASSERT_TRUE(intskiplist_push(list, i));
+    intskiplist_reverse(list);
+
+    // Positional access relies on the spans rebuilt by the reversal
+    int value;
+    for (int i = 0; i < 300; i++) {
+        ASSERT_TRUE(intskiplist_get_at(list, i, &value));
+        ASSERT_EQUAL(value, 299 - i);
+    }
+
+    ASSERT_TRUE(intskiplist_push_at(list, -1, 150));
+    intskiplist_pop_at(list, 0);
+    ASSERT_TRUE(intskiplist_get_at(list, 149, &value));
+    ASSERT_EQUAL(value, -1);
+    ASSERT_TRUE(intskiplist_back(list, &value));
+    ASSERT_EQUAL(value, 0);
+}
+
+TEST(functional) {
+    int arr[100];
+    for (int i = 0; i < 100; i++) arr[i] = i + 1;
+
+    IntSkipList list = intskiplist_from_array(arr, 100);
+    ASSERT_NOT_NULL(list);
+    ASSERT_EQUAL(intskiplist_sum(list), 5050);
+    ASSERT_EQUAL(intskiplist_index(list, 42), 41);
+    ASSERT_EQUAL(intskiplist_count(list, 42), 1);
+    ASSERT_TRUE(intskiplist_contains(list, 100));
+
+    int twice(int num) { return num * 2; }
+    bool is_even(int num) { return num % 2 == 0; }
+
+    IntSkipList doubled = intskiplist_map(list, twice);
+    ASSERT_EQUAL(intskiplist_sum(doubled), 10100);
+    ASSERT_TRUE(intskiplist_all(doubled, is_even));
+
+    IntSkipList evens = intskiplist_filter(list, is_even);
+    ASSERT_EQUAL(intskiplist_size(evens), 50);
+
+    int value;
+    ASSERT_TRUE(intskiplist_get_at(evens, 24, &value));
+    ASSERT_EQUAL(value, 50);
+
+    IntSkipList copy = intskiplist_copy(list);
+    ASSERT_TRUE(intskiplist_equals(copy, list));
+    intskiplist_pop_at(copy, 50);
+    ASSERT_FALSE(intskiplist_equals(copy, list));
+
+    ASSERT_EQUAL(intskiplist_size(intskiplist_zip(list, evens)), 100);
+}
+
+TEST(conversions) {
+    IntSkipList list = intskiplist_new();
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(intlist_is_empty(intskiplist_to_list(list)));
+    ASSERT_TRUE(intstack_is_empty(intskiplist_to_stack(list)));
+    ASSERT_TRUE(intqueue_is_empty(intskiplist_to_queue(list)));
+
+    // Not a whole number of batches or chunks, so the last partial one is copied too
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(intskiplist_push(list, i));
+
+    IntList copy = intskiplist_to_list(list);
+    IntStack stack = intskiplist_to_stack(list);
+    IntQueue queue = intskiplist_to_queue(list);
+    ASSERT_EQUAL(intlist_size(copy), 1000);
+    ASSERT_EQUAL(intstack_size(stack), 1000);
+    ASSERT_EQUAL(intqueue_size(queue), 1000);
+
+    bool in_order = true;
+    int value;
+    for (int i = 0; i < 1000; i++) in_order = in_order && intlist_get_at(copy, i, &value) && value == i;
+    for (int i = 999; i >= 0; i--) in_order = in_order && intstack_pop(stack, &value) && value == i;
+    for (int i = 0; i < 1000; i++) in_order = in_order && intqueue_dequeue(queue, &value) && value == i;
+    ASSERT_TRUE(in_order);
+
+    ASSERT_NULL(intskiplist_to_list(NULL));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"push and pop ends", test_push_and_pop_ends},
+        {"random positions", test_random_positions},
+        {"reverse", test_reverse},
+        {"functional", test_functional},
+        {"conversions", test_conversions},
+    };
+
+    TestSuite suite = {.name = "IntSkipList", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "test.h"
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include "queue/intspscqueue.h"
+
+TEST(new) {
+    IntSpscQueue queue = intspscqueue_new(10);
+    ASSERT_NOT_NULL(queue);
+
+    ASSERT_TRUE(intspscqueue_is_empty(queue));
+    ASSERT_EQUAL(intspscqueue_size(queue), 0);
+    ASSERT_EQUAL(intspscqueue_capacity(queue), 10);
+    ASSERT_FALSE(intspscqueue_is_full(queue));
+
+    int value;
+    ASSERT_FALSE(intspscqueue_peek(queue, &value));
+    ASSERT_FALSE(intspscqueue_dequeue(queue, &value));
+    ASSERT_NULL(intspscqueue_new(0));
+}
+
+TEST(bounded_fifo) {
+    IntSpscQueue queue = intspscqueue_new(10);
+    ASSERT_NOT_NULL(queue);
+
+    for (int i = 0; i < 10; i++) ASSERT_TRUE(intspscqueue_enqueue(queue, i));
+    ASSERT_TRUE(intspscqueue_is_full(queue));
+    ASSERT_FALSE(intspscqueue_enqueue(queue, 10));
+
+    int value;
+    ASSERT_TRUE(intspscqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 0);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(intspscqueue_dequeue(queue, &value));
+        ASSERT_EQUAL(value, i);
+    }
+    ASSERT_TRUE(intspscqueue_is_empty(queue));
+    ASSERT_FALSE(intspscqueue_enqueue(NULL, 1));
+}
+
+TEST(batches) {
+    IntSpscQueue queue = intspscqueue_new(20);
+    ASSERT_NOT_NULL(queue);
+
+    int arr[13], out[11];
+
+    // Batches are cut to the room left, and odd sizes keep moving the split point around the ring end
+    int next_in = 0, next_out = 0;
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 13; i++) arr[i] = next_in + i;
+        size_t sent = intspscqueue_enqueue_n(queue, arr, 13);
+        ASSERT_TRUE(sent <= 13 && intspscqueue_size(queue) <= 20);
+        next_in += sent;
+
+        size_t got = intspscqueue_dequeue_n(queue, out, 11);
+        for (size_t i = 0; i < got; i++) ASSERT_EQUAL(out[i], next_out++);
+    }
+    ASSERT_EQUAL(intspscqueue_size(queue), next_in - next_out);
+
+    ASSERT_EQUAL(intspscqueue_enqueue_n(queue, NULL, 3), 0);
+    ASSERT_EQUAL(intspscqueue_dequeue_n(queue, NULL, 3), 0);
+}
+
+TEST(two_threads) {
+    IntSpscQueue queue = intspscqueue_new(1024);
+    ASSERT_NOT_NULL(queue);
+
+    const int count = 1000000;
+    void* produce(void* arg) {
+        (void) arg;
+        int batch[64];
+        for (int next = 0; next < count; ) {
+            // Alternate single and batch enqueues so both paths race against the consumer
+            if (next % 3 == 0) {
+                if (intspscqueue_enqueue(queue, next)) next++;
+                else sched_yield();
+                continue;
+            }
+
+            int size = count - next < 64 ? count - next : 64;
+            for (int i = 0; i < size; i++) batch[i] = next + i;
+            size_t sent = intspscqueue_enqueue_n(queue, batch, size);
+            if (sent == 0) sched_yield();
+            next += sent;
+        }
+        return NULL;
+    }
+
+    pthread_t producer;
+    ASSERT_EQUAL(pthread_create(&producer, NULL, produce, NULL), 0);
+
+    int out[50], expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        size_t got = intspscqueue_dequeue_n(queue, out, 50);
+        if (got == 0) sched_yield();
+        for (size_t i = 0; i < got; i++) ordered = ordered && out[i] == expected++;
+    }
+    pthread_join(producer, NULL);
+
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(intspscqueue_is_empty(queue));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"bounded fifo", test_bounded_fifo},
+        {"batches", test_batches},
+        {"two threads", test_two_threads},
+    };
+
+    TestSuite suite = {.name = "IntSpscQueue", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "test.h"
+#include <stdio.h>
+#include "stream/intstream.h"
+#include "linkedlist/intlist.h"
+#include "arraylist/intvec.h"
+#include "queue/intqueue.h"
+
+TEST(sources) {
+    int arr[] = {1, 2, 3, 4, 5};
+
+    IntList list = intlist_from_array(arr, 5);
+    IntVec vec = intvec_from_array(arr, 5);
+    IntQueue queue = intqueue_new();
+    for (int i = 0; i < 5; i++) ASSERT_TRUE(intqueue_enqueue(queue, arr[i]));
+
+    ASSERT_EQUAL(intstream_sum(intstream_from_list(list)), 15);
+    ASSERT_EQUAL(intstream_sum(intstream_from_vec(vec)), 15);
+    ASSERT_EQUAL(intstream_sum(intstream_from_queue(queue)), 15);
+    ASSERT_EQUAL(intstream_sum(intstream_from_array(arr, 5)), 15);
+    ASSERT_EQUAL(intstream_count(intstream_from_array(NULL, 0)), 0);
+
+    // Streaming never consumes the source
+    ASSERT_EQUAL(intqueue_size(queue), 5);
+
+    ASSERT_NULL(intstream_from_list(NULL));
+    ASSERT_NULL(intstream_from_array(NULL, 5));
+    ASSERT_EQUAL(intstream_sum(NULL), 0);
+}
+
+TEST(fused_stages) {
+    IntList list = intlist_new();
+    ASSERT_NOT_NULL(list);
+    for (int i = 1; i <= 100; i++) ASSERT_TRUE(intlist_push(list, i));
+
+    int calls = 0;
+    bool is_even(int num) { return num % 2 == 0; }
+    int square(int num) { calls++; return num * num; }
+    long long add(long long acc, int value) { return acc + value; }
+
+    IntStream stream = intstream_map(intstream_filter(intstream_from_list(list), is_even), square);
+    ASSERT_NOT_NULL(stream);
+    ASSERT_EQUAL(calls, 0);
+
+    ASSERT_EQUAL(intstream_count(stream), 50);
+    ASSERT_EQUAL(intstream_sum(stream), 171700);
+    ASSERT_EQUAL(intstream_reduce(stream, add, 1), 171701);
+
+    IntList collected = intstream_collect(stream);
+    ASSERT_TRUE(intlist_equals(collected, intlist_map(intlist_filter(list, is_even), square)));
+
+    IntVec collected_vec = intstream_collect_vec(stream);
+    ASSERT_EQUAL(intvec_size(collected_vec), 50);
+}
+
+TEST(take_and_skip) {
+    int arr[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    int calls = 0;
+    int count_calls(int num) { calls++; return num; }
+
+    // Take stops the source walk, so upstream stages never see the values after the limit
+    IntStream stream = intstream_take(intstream_map(intstream_from_array(arr, 10), count_calls), 3);
+    ASSERT_EQUAL(intstream_sum(stream), 6);
+    ASSERT_EQUAL(calls, 3);
+
+    // Budgets are per run, so the same stream gives the same answer twice
+    ASSERT_EQUAL(intstream_sum(stream), 6);
+
+    // The last value take lets through is dropped further down, which must still stop the walk there
+    calls = 0;
+    bool is_even(int num) { return num % 2 == 0; }
+    IntStream dropped = intstream_filter(intstream_take(intstream_map(intstream_from_array(arr, 10), count_calls), 3), is_even);
+    ASSERT_EQUAL(intstream_sum(dropped), 2);
+    ASSERT_EQUAL(calls, 3);
+
+    calls = 0;
+    ASSERT_EQUAL(intstream_count(intstream_skip(intstream_take(intstream_map(intstream_from_array(arr, 10), count_calls), 2), 5)), 0);
+    ASSERT_EQUAL(calls, 2);
+
+    IntStream window = intstream_take(intstream_skip(intstream_from_array(arr, 10), 4), 2);
+    IntList collected = intstream_collect(window);
+    int expected[] = {5, 6};
+    ASSERT_TRUE(intlist_equals(collected, intlist_from_array(expected, 2)));
+    ASSERT_EQUAL(intstream_sum(window), 11);
+
+    ASSERT_EQUAL(intstream_count(intstream_take(intstream_from_array(arr, 10), 0)), 0);
+    ASSERT_EQUAL(intstream_count(intstream_skip(intstream_from_array(arr, 10), 20)), 0);
+    ASSERT_EQUAL(intstream_count(intstream_take(intstream_from_array(arr, 10), 20)), 10);
+}
+
+TEST(reentrant_runs) {
+    int arr[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    static IntStream stream;
+    stream = intstream_take(intstream_skip(intstream_from_array(arr, 10), 2), 3);
+
+    // Each run keeps its own budgets, so a nested run on the same stream leaves the outer one untouched
+    long long add_with_count(long long acc, int value) { return acc + value + (long long) intstream_count(stream); }
+    ASSERT_EQUAL(intstream_reduce(stream, add_with_count, 0), 21);
+
+    // Pipelines longer than the on-stack budget array take the heap path
+    int identity(int value) { return value; }
+    IntStream long_stream = intstream_from_array(arr, 10);
+    for (int i = 0; i < 20; i++) long_stream = intstream_map(long_stream, identity);
+    ASSERT_EQUAL(intstream_sum(intstream_take(intstream_skip(long_stream, 1), 2)), 5);
+}
+
+int main() {
+    TestCase tests[] = {
+        {"sources", test_sources},
+        {"fused stages", test_fused_stages},
+        {"take and skip", test_take_and_skip},
+        {"reentrant runs", test_reentrant_runs},
+    };
+
+    TestSuite suite = {.name = "IntStream", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
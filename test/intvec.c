@@ -0,0 +1,301 @@
+#include "test.h"
+#include <stdio.h>
+#include "arraylist/intvec.h"
+#include "linkedlist/intlist.h"
+#include "stack/intstack.h"
+#include "queue/intqueue.h"
+
+TEST(new) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+    ASSERT_TRUE(intvec_is_empty(vec));
+    ASSERT_EQUAL(intvec_size(vec), 0);
+    ASSERT_EQUAL(intvec_capacity(vec), 0);
+
+    IntVec reserved = intvec_with_capacity(100);
+    ASSERT_NOT_NULL(reserved);
+    ASSERT_TRUE(intvec_is_empty(reserved));
+    ASSERT_EQUAL(intvec_capacity(reserved), 100);
+}
+
+TEST(push_and_get) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(intvec_push(vec, i));
+    ASSERT_EQUAL(intvec_size(vec), 1000);
+    ASSERT_TRUE(intvec_capacity(vec) >= 1000);
+
+    int value;
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_TRUE(intvec_get_at(vec, i, &value));
+        ASSERT_EQUAL(value, i);
+    }
+    ASSERT_FALSE(intvec_get_at(vec, 1000, &value));
+
+    ASSERT_TRUE(intvec_set_at(vec, 500, -1));
+    ASSERT_TRUE(intvec_get_at(vec, 500, &value));
+    ASSERT_EQUAL(value, -1);
+    ASSERT_FALSE(intvec_set_at(vec, 1000, 0));
+
+    ASSERT_TRUE(intvec_front(vec, &value));
+    ASSERT_EQUAL(value, 0);
+    ASSERT_TRUE(intvec_back(vec, &value));
+    ASSERT_EQUAL(value, 999);
+
+    ASSERT_FALSE(intvec_push(NULL, 1));
+}
+
+TEST(push_at_and_pop_at) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+
+    ASSERT_FALSE(intvec_push_at(vec, 1, 1));
+    ASSERT_TRUE(intvec_push_at(vec, 28, 0));
+    ASSERT_TRUE(intvec_push_at(vec, 30, 1));
+    ASSERT_TRUE(intvec_push_at(vec, 29, 1));
+    ASSERT_TRUE(intvec_push_at(vec, 27, 0));
+
+    int value;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(intvec_get_at(vec, i, &value));
+        ASSERT_EQUAL(value, 27 + i);
+    }
+
+    intvec_pop_at(vec, 1);
+    intvec_pop(vec);
+    ASSERT_EQUAL(intvec_size(vec), 2);
+    ASSERT_TRUE(intvec_get_at(vec, 1, &value));
+    ASSERT_EQUAL(value, 29);
+
+    intvec_pop_at(vec, 5);
+    ASSERT_EQUAL(intvec_size(vec), 2);
+}
+
+TEST(reserve_and_shrink) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+
+    ASSERT_TRUE(intvec_reserve(vec, 64));
+    ASSERT_EQUAL(intvec_capacity(vec), 64);
+
+    // Reserving less than the current capacity keeps it unchanged
+    ASSERT_TRUE(intvec_reserve(vec, 10));
+    ASSERT_EQUAL(intvec_capacity(vec), 64);
+
+    for (int i = 0; i < 5; i++) ASSERT_TRUE(intvec_push(vec, i));
+    ASSERT_TRUE(intvec_shrink_to_fit(vec));
+    ASSERT_EQUAL(intvec_capacity(vec), 5);
+    ASSERT_EQUAL(intvec_size(vec), 5);
+
+    intvec_clear(vec);
+    ASSERT_TRUE(intvec_is_empty(vec));
+    ASSERT_TRUE(intvec_shrink_to_fit(vec));
+    ASSERT_EQUAL(intvec_capacity(vec), 0);
+
+    ASSERT_FALSE(intvec_reserve(NULL, 1));
+    ASSERT_FALSE(intvec_shrink_to_fit(NULL));
+}
+
+TEST(append_array) {
+    int arr[] = {1, 2, 3, 4, 5};
+    IntVec vec = intvec_from_array(arr, 5);
+    ASSERT_NOT_NULL(vec);
+
+    ASSERT_TRUE(intvec_append_array(vec, arr, 5));
+    ASSERT_TRUE(intvec_append_array(vec, NULL, 0));
+    ASSERT_FALSE(intvec_append_array(vec, NULL, 3));
+    ASSERT_EQUAL(intvec_size(vec), 10);
+
+    int value;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(intvec_get_at(vec, i, &value));
+        ASSERT_EQUAL(value, arr[i % 5]);
+    }
+
+    ASSERT_NULL(intvec_from_array(NULL, 5));
+    ASSERT_NULL(intvec_from_array(arr, 0));
+}
+
+TEST(search_and_equals) {
+    int arr[] = {5, 3, 8, 3, 9};
+    IntVec vec = intvec_from_array(arr, 5);
+    ASSERT_NOT_NULL(vec);
+
+    ASSERT_EQUAL(intvec_index(vec, 3), 1);
+    ASSERT_EQUAL(intvec_index(vec, 42), -1);
+    ASSERT_EQUAL(intvec_count(vec, 3), 2);
+    ASSERT_TRUE(intvec_contains(vec, 9));
+    ASSERT_FALSE(intvec_contains(vec, 42));
+
+    IntVec copy = intvec_copy(vec);
+    ASSERT_TRUE(intvec_equals(vec, copy));
+    ASSERT_TRUE(intvec_set_at(copy, 0, 6));
+    ASSERT_FALSE(intvec_equals(vec, copy));
+    ASSERT_TRUE(intvec_equals(intvec_new(), intvec_new()));
+    ASSERT_FALSE(intvec_equals(vec, NULL));
+}
+
+TEST(min_and_max) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+
+    int value;
+    ASSERT_FALSE(intvec_min(vec, &value));
+    ASSERT_FALSE(intvec_max(vec, &value));
+
+    // Enough values to cover both the vector body and the scalar tail of the kernels
+    for (int i = 0; i < 101; i++) ASSERT_TRUE(intvec_push(vec, (i * 37) % 101 - 50));
+    ASSERT_TRUE(intvec_min(vec, &value));
+    ASSERT_EQUAL(value, -50);
+    ASSERT_TRUE(intvec_max(vec, &value));
+    ASSERT_EQUAL(value, 50);
+    ASSERT_FALSE(intvec_min(vec, NULL));
+}
+
+TEST(functional) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+
+    for (int i = 1; i <= 100; i++) ASSERT_TRUE(intvec_push(vec, i));
+    ASSERT_EQUAL(intvec_sum(vec), 5050);
+
+    int square(int num) { return num * num; }
+    bool is_odd(int num) { return num % 2 != 0; }
+    long long add(long long acc, int value) { return acc + value; }
+
+    IntVec squared = intvec_map(vec, square);
+    ASSERT_NOT_NULL(squared);
+    ASSERT_EQUAL(intvec_size(squared), 100);
+    ASSERT_EQUAL(intvec_reduce(squared, add, 0), 338350);
+
+    IntVec odds = intvec_filter(vec, is_odd);
+    ASSERT_NOT_NULL(odds);
+    ASSERT_EQUAL(intvec_size(odds), 50);
+    ASSERT_TRUE(intvec_all(odds, is_odd));
+    ASSERT_FALSE(intvec_any(intvec_map(odds, square), NULL));
+
+    IntVec zipped = intvec_zip(vec, odds);
+    ASSERT_EQUAL(intvec_size(zipped), 100);
+
+    intvec_reverse(vec);
+    int value;
+    ASSERT_TRUE(intvec_front(vec, &value));
+    ASSERT_EQUAL(value, 100);
+}
+
+TEST(parallel) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+
+    // Large enough to be split into chunks instead of taking the sequential path
+    for (int i = 0; i < 100000; i++) ASSERT_TRUE(intvec_push(vec, i));
+
+    int triple(int num) { return 3 * num; }
+    bool is_odd(int num) { return num % 2 != 0; }
+    long long add(long long acc, int value) { return acc + value; }
+    long long combine(long long acc1, long long acc2) { return acc1 + acc2; }
+
+    ASSERT_TRUE(intvec_equals(intvec_par_map(vec, triple), intvec_map(vec, triple)));
+
+    IntVec odds = intvec_par_filter(vec, is_odd);
+    ASSERT_EQUAL(intvec_size(odds), 50000);
+    ASSERT_TRUE(intvec_equals(odds, intvec_filter(vec, is_odd)));
+
+    ASSERT_EQUAL(intvec_par_reduce(vec, add, combine, 0), intvec_sum(vec));
+    ASSERT_EQUAL(intvec_par_reduce(NULL, add, combine, 7), 7);
+}
+
+TEST(batch) {
+    IntVec vec = intvec_new();
+    ASSERT_NOT_NULL(vec);
+
+    for (int i = 0; i < 1000; i++) ASSERT_TRUE(intvec_push(vec, i));
+
+    int triple(int num) { return 3 * num; }
+    bool is_odd(int num) { return num % 2 != 0; }
+    void triple_batch(int* values, size_t size, void* ctx) {
+        (void) ctx;
+        for (size_t i = 0; i < size; i++) values[i] *= 3;
+    }
+    void odd_batch(const int* values, bool* keep, size_t size, void* ctx) {
+        (*(int*) ctx)++;
+        for (size_t i = 0; i < size; i++) keep[i] = values[i] % 2 != 0;
+    }
+    long long add_batch(long long acc, const int* values, size_t size, void* ctx) {
+        (void) ctx;
+        for (size_t i = 0; i < size; i++) acc += values[i];
+        return acc;
+    }
+
+    IntVec tripled = intvec_map_batch(vec, triple_batch, NULL);
+    ASSERT_TRUE(intvec_equals(tripled, intvec_map(vec, triple)));
+
+    int calls = 0;
+    IntVec odds = intvec_filter_batch(vec, odd_batch, &calls);
+    ASSERT_EQUAL(intvec_size(odds), 500);
+    ASSERT_TRUE(intvec_equals(odds, intvec_filter(vec, is_odd)));
+    ASSERT_EQUAL(calls, 4);
+
+    ASSERT_EQUAL(intvec_reduce_batch(vec, add_batch, 10, NULL), intvec_sum(vec) + 10);
+
+    intvec_foreach_batch(vec, triple_batch, NULL);
+    ASSERT_TRUE(intvec_equals(vec, tripled));
+
+    ASSERT_NULL(intvec_map_batch(NULL, triple_batch, NULL));
+    ASSERT_EQUAL(intvec_reduce_batch(NULL, add_batch, 7, NULL), 7);
+}
+
+TEST(conversions) {
+    int arr[] = {1, 2, 3};
+    IntVec vec = intvec_from_array(arr, 3);
+    ASSERT_NOT_NULL(vec);
+
+    IntList list = intvec_to_list(vec);
+    ASSERT_TRUE(intlist_equals(list, intlist_from_array(arr, 3)));
+
+    int value;
+    IntStack stack = intvec_to_stack(vec);
+    ASSERT_TRUE(intstack_peek(stack, &value));
+    ASSERT_EQUAL(value, 3);
+
+    IntQueue queue = intvec_to_queue(vec);
+    ASSERT_TRUE(intqueue_peek(queue, &value));
+    ASSERT_EQUAL(value, 1);
+
+    int* copy = intvec_to_array(vec);
+    ASSERT_NOT_NULL(copy);
+    for (int i = 0; i < 3; i++) ASSERT_EQUAL(copy[i], arr[i]);
+
+    // The bulk copies keep the whole order, not just the ends
+    bool in_order = true;
+    for (int i = 3; i > 0; i--) in_order = in_order && intstack_pop(stack, &value) && value == i;
+    for (int i = 1; i <= 3; i++) in_order = in_order && intqueue_dequeue(queue, &value) && value == i;
+    ASSERT_TRUE(in_order);
+
+    IntVec empty = intvec_new();
+    ASSERT_TRUE(intlist_is_empty(intvec_to_list(empty)));
+    ASSERT_TRUE(intstack_is_empty(intvec_to_stack(empty)));
+    ASSERT_TRUE(intqueue_is_empty(intvec_to_queue(empty)));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"new", test_new},
+        {"push and get", test_push_and_get},
+        {"push_at and pop_at", test_push_at_and_pop_at},
+        {"reserve and shrink", test_reserve_and_shrink},
+        {"append array", test_append_array},
+        {"search and equals", test_search_and_equals},
+        {"min and max", test_min_and_max},
+        {"functional", test_functional},
+        {"parallel", test_parallel},
+        {"batch", test_batch},
+        {"conversions", test_conversions},
+    };
+
+    TestSuite suite = {.name = "IntVec", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}
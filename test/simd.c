@@ -0,0 +1,60 @@
+#include "test.h"
+#include <stdio.h>
+#include "internal/simd.h"
+
+#define SIZE 131
+
+TEST(kernels_agree) {
+    int arr[SIZE], other[SIZE];
+    char bytes[SIZE];
+    for (int i = 0; i < SIZE; i++) {
+        arr[i] = other[i] = (i * 7919) % 257 - 128;
+        bytes[i] = 'a' + i % 26;
+    }
+
+    SimdLevel selected = _simd_level();
+    ASSERT_TRUE(_simd_select(SIMD_SCALAR));
+
+    // Every odd length exercises a different split between vector body and scalar tail
+    for (size_t size = 1; size <= SIZE; size += 2) {
+        long long sum = _simd_sum_int(arr, size);
+        int min = _simd_min_int(arr, size), max = _simd_max_int(arr, size);
+        size_t count = _simd_count_int(arr, size, arr[size - 1]);
+        size_t find = _simd_find_int(arr, size, arr[size - 1]);
+        size_t count_byte = _simd_count_byte(bytes, size, 'z');
+        size_t find_byte = _simd_find_byte(bytes, size, bytes[size - 1]);
+
+        for (SimdLevel level = SIMD_SSE2; level <= SIMD_AVX512; level++) {
+            if (!_simd_select(level)) continue;
+
+            ASSERT_EQUAL(_simd_sum_int(arr, size), sum);
+            ASSERT_EQUAL(_simd_min_int(arr, size), min);
+            ASSERT_EQUAL(_simd_max_int(arr, size), max);
+            ASSERT_EQUAL(_simd_count_int(arr, size, arr[size - 1]), count);
+            ASSERT_EQUAL(_simd_find_int(arr, size, arr[size - 1]), find);
+            ASSERT_EQUAL(_simd_find_int(arr, size, 1000), size);
+            ASSERT_TRUE(_simd_equals_int(arr, other, size));
+            ASSERT_EQUAL(_simd_count_byte(bytes, size, 'z'), count_byte);
+            ASSERT_EQUAL(_simd_find_byte(bytes, size, bytes[size - 1]), find_byte);
+            ASSERT_EQUAL(_simd_find_byte(bytes, size, '#'), size);
+
+            other[size - 1]++;
+            ASSERT_FALSE(_simd_equals_int(arr, other, size));
+            other[size - 1]--;
+        }
+        _simd_select(SIMD_SCALAR);
+    }
+
+    ASSERT_TRUE(_simd_select(selected));
+}
+
+int main() {
+    TestCase tests[] = {
+        {"kernels agree", test_kernels_agree},
+    };
+
+    TestSuite suite = {.name = "SIMD", .tests = tests, .tests_num = sizeof (tests) / sizeof (tests[0])};
+
+    run_suite_tests(&suite);
+    return 0;
+}